@@ -60,6 +60,25 @@ namespace BansheeEngine
 		BS_LOCK_TYPE mLock;
 	};
 
+	/**
+	 * @brief	Command queue policy that allows commands to be queued from multiple threads without
+	 * 			any locking. Commands may only be flushed and played back from a single thread.
+	 * 			
+	 * @note	Command queues using this policy use a specialized lock-free implementation. Prefer it over
+	 * 			CommandQueueSync for queues that are heavily contended.
+	 */
+	class CommandQueueLockFree
+	{
+	public:
+		CommandQueueLockFree() {}
+		virtual ~CommandQueueLockFree() {}
+
+		bool isValidThread(BS_THREAD_ID_TYPE ownerThread) const
+		{
+			return true;
+		}
+	};
+
 	/**
 	 * @brief	Represents a single queued command in the command list. Contains all the data for executing the command
 	 * 			and checking up on the command status.
@@ -234,12 +253,18 @@ namespace BansheeEngine
 		 */
 		void throwInvalidThreadException(const String& message) const;
 
+		/**
+		 * @brief	Executes a single command, and calls the notify callback if the command requested it.
+		 */
+		static void execute(QueuedCommand& command, const std::function<void(UINT32)>& notifyCallback);
+
 	private:
 		BansheeEngine::Queue<QueuedCommand>* mCommands;
 		Stack<BansheeEngine::Queue<QueuedCommand>*> mEmptyCommandQueues; // List of empty queues for reuse
 
 		BS_THREAD_ID_TYPE mMyThreadId;
 
+	protected:
 		// Various variables that allow for easier debugging by allowing us to trigger breakpoints
 		// when a certain command was queued.
 #if BS_DEBUG_MODE
@@ -399,4 +424,107 @@ namespace BansheeEngine
 			return empty;
 		}
 	};
+
+	/**
+	 * @copydoc CommandQueueBase
+	 * 			
+	 * @brief	Command queue that may be queued on from multiple threads without locking, and flushed
+	 *			from a single thread.
+	 *			
+	 * @note	Producers push commands on an atomic singly linked list. The consumer takes the entire list
+	 *			at once when flushing and restores the queuing order, so commands are played back in batches
+	 *			directly from the list. Commands queued from a single thread are always executed in the order 
+	 *			they were queued.
+	 */
+	template<>
+	class BS_CORE_EXPORT CommandQueue<CommandQueueLockFree> : public CommandQueueBase, public CommandQueueLockFree
+	{
+	public:
+		/**
+		 * @brief	Single entry in the list of queued commands.
+		 */
+		struct CommandNode
+		{
+			template<class... Args>
+			CommandNode(Args&&... args)
+				:command(std::forward<Args>(args)...), next(nullptr)
+			{ }
+
+			QueuedCommand command;
+			CommandNode* next;
+		};
+
+		/**
+		 * @copydoc CommandQueueBase::CommandQueueBase
+		 */
+		CommandQueue(BS_THREAD_ID_TYPE threadId);
+		~CommandQueue();
+
+		/**
+		 * @copydoc CommandQueueBase::queueReturn
+		 * 			
+		 * @note	Thread safe.
+		 */
+		AsyncOp queueReturn(std::function<void(AsyncOp&)> commandCallback, bool _notifyWhenComplete = false, UINT32 _callbackId = 0);
+
+		/**
+		 * @copydoc CommandQueueBase::queue
+		 * 			
+		 * @note	Thread safe.
+		 */
+		void queue(std::function<void()> commandCallback, bool _notifyWhenComplete = false, UINT32 _callbackId = 0);
+
+		/**
+		 * @brief	Takes all queued commands and makes room for new ones. Returned list of commands MUST be passed 
+		 *			to "playback" or "playbackWithNotify" of this queue.
+		 * 			
+		 * @note	Must only be called from a single (consumer) thread.
+		 */
+		CommandNode* flush();
+
+		/**
+		 * @copydoc CommandQueueBase::playbackWithNotify
+		 *
+		 * @note	Commands must have been retrieved by calling flush() on this queue.
+		 */
+		void playbackWithNotify(CommandNode* commands, std::function<void(UINT32)> notifyCallback);
+
+		/**
+		 * @copydoc CommandQueueBase::playback
+		 *
+		 * @note	Commands must have been retrieved by calling flush() on this queue.
+		 */
+		void playback(CommandNode* commands);
+
+		/**
+		 * @copydoc CommandQueueBase::cancelAll
+		 * 			
+		 * @note	Must only be called from a single (consumer) thread.
+		 */
+		void cancelAll();
+
+		/**
+		 * @copydoc CommandQueueBase::isEmpty
+		 * 			
+		 * @note	Thread safe.
+		 */
+		bool isEmpty();
+
+	private:
+		/**
+		 * @brief	Adds a new command node to the front of the list.
+		 */
+		void push(CommandNode* node);
+
+		/**
+		 * @brief	Removes all nodes from the list and returns them in the order they were pushed in.
+		 */
+		CommandNode* popAll();
+
+		std::atomic<CommandNode*> mHead;
+
+#if BS_DEBUG_MODE
+		std::atomic<UINT32> mNextDebugIdx;
+#endif
+	};
 }
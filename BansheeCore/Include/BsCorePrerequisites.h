@@ -127,6 +127,7 @@ namespace BansheeEngine
 	class TimerQuery;
 	class OcclusionQuery;
 	class FrameAlloc;
+	class FrameAllocRegistry;
 	class FolderMonitor;
 	class VideoMode;
 	class VideoOutputInfo;
@@ -145,6 +146,9 @@ namespace BansheeEngine
 	class Resource;
 	class Resources;
 	class ResourceManifest;
+	class SavedResourceData;
+	class ResourcePack;
+	class UUID;
 	class Texture;
 	class Mesh;
 	class MeshBase;
@@ -172,6 +176,8 @@ namespace BansheeEngine
 	class CoreThreadAccessor;
 	class CommandQueueNoSync;
 	class CommandQueueSync;
+	class CommandQueueLockFree;
+	class FrameCommandBuffer;
 }
 
 /************************************************************************/
@@ -229,6 +235,8 @@ namespace BansheeEngine
 	typedef std::shared_ptr<TimerQuery> TimerQueryPtr;
 	typedef std::shared_ptr<OcclusionQuery> OcclusionQueryPtr;
 	typedef std::shared_ptr<ResourceManifest> ResourceManifestPtr;
+	typedef std::shared_ptr<SavedResourceData> SavedResourceDataPtr;
+	typedef std::shared_ptr<ResourcePack> ResourcePackPtr;
 	typedef std::shared_ptr<VideoModeInfo> VideoModeInfoPtr;
 	typedef std::shared_ptr<DrawList> DrawListPtr;
 	typedef std::shared_ptr<RenderQueue> RenderQueuePtr;
@@ -299,7 +307,9 @@ namespace BansheeEngine
 		TID_ResourceManifest = 1067,
 		TID_ResourceManifestEntry = 1068,
 		TID_EmulatedParamBlock = 1069,
-		TID_TextureImportOptions = 1070
+		TID_TextureImportOptions = 1070,
+		TID_SavedResourceData = 1071,
+		TID_UUID = 1072
 	};
 }
 
@@ -369,6 +379,12 @@ namespace BansheeEngine
 		static void onThreadEnded(const String& name)
 		{
 			MemStack::endThread();
+			ScratchAllocator::releaseThreadMemory();
+			PoolAllocator::releaseThreadCache();
+
+#if BS_MEMORY_TRACKING_ENABLED
+			MemoryTracker::endThread();
+#endif
 		}
 	};
 }
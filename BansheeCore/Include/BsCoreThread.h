@@ -72,8 +72,8 @@ public:
 	BS_CORE_EXPORT void submitAccessors(bool blockUntilComplete = false);
 
 	/**
-		* @brief	Queues a new command that will be added to the global command queue. You are allowed to call this from any thread,
-		* 			however be aware that it involves possibly slow synchronization primitives, so limit your usage.
+		* @brief	Queues a new command that will be added to the global command queue. You are allowed to call this from any thread.
+		* 			Queuing doesn't lock, but waking up the core thread if it is idle does, so prefer accessors for many small commands.
 		* 			
 		* @param	blockUntilComplete If true the thread will be blocked until the command executes. Be aware that there may be many commands queued before it
 		* 							   and they all need to be executed in order before the current command is reached, which might take a long time.
@@ -83,8 +83,8 @@ public:
 	BS_CORE_EXPORT AsyncOp queueReturnCommand(std::function<void(AsyncOp&)> commandCallback, bool blockUntilComplete = false);
 
 	/**
-	* @brief	Queues a new command that will be added to the global command queue.You are allowed to call this from any thread,
-		* 			however be aware that it involves possibly slow synchronization primitives, so limit your usage.
+	* @brief	Queues a new command that will be added to the global command queue. You are allowed to call this from any thread.
+		* 			Queuing doesn't lock, but waking up the core thread if it is idle does, so prefer accessors for many small commands.
 		* 	
 		* @param	blockUntilComplete If true the thread will be blocked until the command executes. Be aware that there may be many commands queued before it
 		* 							   and they all need to be executed in order before the current command is reached, which might take a long time.
@@ -104,21 +104,22 @@ public:
 	 * 			core thread. As the name implies the data only lasts one frame, so you need to be careful not
 	 * 			to use it for longer than that.
 	 * 			
-	 * @note	Sim thread only.
+	 * @note	Each calling thread receives its own allocator, so it may be used from any thread other than the
+	 * 			core thread (e.g. from tasks). Tasks using it must complete before the sim thread calls update().
 	 */
 	BS_CORE_EXPORT FrameAlloc* getFrameAlloc() const;
 private:
 	/**
-	 * @brief	Double buffered frame allocators. Means sim thread cannot be more than 1 frame ahead of core thread
-	 *			(If that changes you should be able to easily add more).
+	 * @brief	Double buffered per-thread frame allocators. Means sim thread cannot be more than 1 frame ahead of 
+	 *			core thread (If that changes you should be able to easily add more).
 	 */
-	FrameAlloc* mFrameAllocs[2]; 
-	UINT32 mActiveFrameAlloc;
+	FrameAllocRegistry* mFrameAllocs;
 
 	static BS_THREADLOCAL AccessorContainer* mAccessor;
 	Vector<AccessorContainer*> mAccessors;
 
 	volatile bool mCoreThreadShutdown;
+	std::atomic<bool> mCoreThreadSleeping;
 
 	HThread mCoreThread;
 	BS_THREAD_ID_TYPE mCoreThreadId;
@@ -128,13 +129,18 @@ private:
 	BS_MUTEX(mCommandNotifyMutex)
 	BS_THREAD_SYNCHRONISER(mCommandCompleteCondition)
 
-	CommandQueue<CommandQueueSync>* mCommandQueue;
+	CommandQueue<CommandQueueLockFree>* mCommandQueue;
 
-	UINT32 mMaxCommandNotifyId; /**< ID that will be assigned to the next command with a notifier callback. */
+	std::atomic<UINT32> mMaxCommandNotifyId; /**< ID that will be assigned to the next command with a notifier callback. */
 	Vector<UINT32> mCommandsCompleted; /**< Completed commands that have notifier callbacks set up */
 
 	SyncedCoreAccessor* mSyncedCoreAccessor;
 
+	/**
+		* @brief	Wakes up the core thread if it is waiting for commands.
+		*/
+	void notifyCommandReady();
+
 	/**
 		* @brief	Starts the core thread worker method. Should only be called once.
 		*/
@@ -6,6 +6,7 @@
 #include "BsCorePrerequisites.h"
 #include "BsRenderSystem.h"
 #include "BsCommandQueue.h"
+#include "BsFrameCommandBuffer.h"
 #include "BsAsyncOp.h"
 #include "BsViewport.h"
 #include "BsColor.h"
@@ -164,6 +165,23 @@ namespace BansheeEngine
 		*/
 		void queueCommand(std::function<void()> commandCallback);
 
+		/**
+		 * @brief	Queues a new generic command whose data is stored in the core thread frame allocator.
+		 * 			Unlike queueCommand this doesn't perform any heap allocations, which makes it preferable
+		 * 			for the large number of small commands issued every frame (e.g. rendering).
+		 * 			
+		 * @param	func	Callable object with signature void(). Anything it references must remain valid until
+		 * 					the command executes, and it must not outlive the frame.
+		 *
+		 * @note	Sim thread only. Commands are executed in the order they were queued in, relative to all other
+		 * 			commands queued on this accessor.
+		 */
+		template<class Func>
+		void queueFrameCommand(Func func)
+		{
+			getFrameCommandBuffer()->queue(std::move(func));
+		}
+
 		/**
 		 * @brief	Makes all the currently queued commands available to the core thread. They will be executed
 		 * 			as soon as the core thread is ready. All queued commands are removed from the accessor.
@@ -176,7 +194,26 @@ namespace BansheeEngine
 		void cancelAll();
 
 	private:
+		/**
+		 * @brief	Returns a frame command buffer that new frame commands can be appended to. If there is no
+		 * 			such buffer a new one is created and a command that executes it is added to the command queue.
+		 */
+		FrameCommandBuffer* getFrameCommandBuffer();
+
+		/**
+		 * @brief	Ends the current frame command buffer so commands queued after this call are guaranteed
+		 * 			to execute after the commands in that buffer.
+		 */
+		void endFrameCommandBuffer();
+
+		/**
+		 * @brief	Destroys all frame command buffers that haven't yet been submitted to the core thread.
+		 */
+		void destroyPendingFrameCommandBuffers();
+
 		CommandQueueBase* mCommandQueue;
+		FrameCommandBuffer* mActiveFrameCommands;
+		Vector<FrameCommandBuffer*> mPendingFrameCommands;
 	};
 
 	/**
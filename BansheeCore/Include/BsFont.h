@@ -66,6 +66,13 @@ namespace BansheeEngine
 		 */
 		INT32 getClosestAvailableSize(UINT32 size) const;
 
+		/**
+		 * @copydoc	Resource::calculateSize
+		 *
+		 * @note	Texture pages are separate resources and are not included.
+		 */
+		UINT32 calculateSize() const;
+
 		/************************************************************************/
 		/* 								STATICS		                     		*/
 		/************************************************************************/
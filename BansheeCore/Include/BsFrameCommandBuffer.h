@@ -0,0 +1,118 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsFrameAlloc.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Linear list of commands whose data is stored in frame allocated memory. Each command is constructed
+	 * 			in place, directly after the previous one, together with its bound parameters. This means queuing
+	 * 			a command never performs a heap allocation (as long as the command object itself doesn't allocate).
+	 * 			
+	 * @note	Commands must be queued on the thread that owns the frame allocator, but they may be executed on 
+	 * 			any thread, as long as that happens before the frame allocator is cleared.
+	 */
+	class BS_CORE_EXPORT FrameCommandBuffer
+	{
+		/**
+		 * @brief	Data common to all commands, placed at the start of every command.
+		 */
+		struct CommandHeader
+		{
+			void (*execute)(CommandHeader*);
+			void (*destroy)(CommandHeader*);
+			CommandHeader* next;
+		};
+
+		/**
+		 * @brief	Command that stores a callable object of a specific type.
+		 */
+		template<class Func>
+		struct Command : CommandHeader
+		{
+			Command(Func&& func)
+				:func(std::move(func))
+			{ 
+				execute = &Command::executeCommand;
+				destroy = &Command::destroyCommand;
+				next = nullptr;
+			}
+
+			static void executeCommand(CommandHeader* header)
+			{
+				static_cast<Command*>(header)->func();
+			}
+
+			static void destroyCommand(CommandHeader* header)
+			{
+				static_cast<Command*>(header)->~Command();
+			}
+
+			Func func;
+		};
+
+	public:
+		/**
+		 * @brief	Creates a new empty command buffer. The buffer and all its commands are allocated
+		 *			using the provided frame allocator.
+		 */
+		static FrameCommandBuffer* create(FrameAlloc* alloc);
+
+		/**
+		 * @brief	Destroys a command buffer previously created with create(). Any commands that
+		 *			were not executed are destroyed without executing.
+		 */
+		static void destroy(FrameCommandBuffer* buffer);
+
+		/**
+		 * @brief	Executes the provided command buffer and destroys it.
+		 */
+		static void executeAndDestroy(FrameCommandBuffer* buffer);
+
+		/**
+		 * @brief	Queues a new command. The callable object is moved into the buffer.
+		 *
+		 * @param	func	Callable object with signature void().
+		 */
+		template<class Func>
+		void queue(Func func)
+		{
+			UINT8* data = mAlloc->alloc(sizeof(Command<Func>), (UINT32)std::alignment_of<Command<Func>>::value);
+			Command<Func>* command = new (data) Command<Func>(std::move(func));
+
+			if (mLast != nullptr)
+				mLast->next = command;
+			else
+				mFirst = command;
+
+			mLast = command;
+		}
+
+		/**
+		 * @brief	Executes all queued commands in the order they were queued in, and destroys them.
+		 */
+		void execute();
+
+		/**
+		 * @brief	Destroys all queued commands without executing them.
+		 */
+		void clear();
+
+		/**
+		 * @brief	Returns true if no commands are queued.
+		 */
+		bool isEmpty() const { return mFirst == nullptr; }
+
+	private:
+		FrameCommandBuffer(FrameAlloc* alloc);
+		~FrameCommandBuffer();
+
+		FrameAlloc* mAlloc;
+		CommandHeader* mFirst;
+		CommandHeader* mLast;
+	};
+}
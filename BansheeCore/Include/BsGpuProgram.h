@@ -186,7 +186,7 @@ namespace BansheeEngine
 		/**
 		 * @copydoc Resource::calculateSize
 		 */
-		size_t calculateSize() const { return 0; } // TODO 
+		UINT32 calculateSize() const { return 0; } // TODO 
 
 	protected:
 		GpuProgramType mType;
@@ -26,5 +26,8 @@ namespace BansheeEngine
 
 		/** @copydoc SpecificImporter::createImportOptions */
 		virtual ImportOptionsPtr createImportOptions() const;
+
+		/** @copydoc SpecificImporter::getExternalInputs */
+		virtual void getExternalInputs(const ConstImportOptionsPtr& importOptions, Vector<String>& contents) const;
 	};
 }
\ No newline at end of file
@@ -62,9 +62,13 @@ namespace BansheeEngine
 		 * 			so you must ensure that external data exists as long as this class uses it. You are also
 		 * 			responsible for deleting the data when you are done with it.
 		 *
+		 * @param	data		Pointer to the external data.
+		 * @param	dataOwner	(optional) Object that owns the external data (e.g. a memory mapped file). If provided
+		 * 						a reference to it is kept for as long as the data is used, keeping the data alive.
+		 *
 		 * @note	If any internal data is allocated, it is freed.
 		 */
-		void setExternalBuffer(UINT8* data);
+		void setExternalBuffer(UINT8* data, const std::shared_ptr<void>& dataOwner = nullptr);
 
 		/**
 		 * @brief	Locks the data and makes it available only to the core thread. 
@@ -89,6 +93,7 @@ namespace BansheeEngine
 
 	private:
 		UINT8* mData;
+		std::shared_ptr<void> mDataOwner;
 		bool mOwnsData;
 		mutable bool mLocked;
 
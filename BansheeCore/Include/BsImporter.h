@@ -5,6 +5,7 @@
 
 #include "BsCorePrerequisites.h"
 #include "BsModule.h"
+#include "BsPath.h"
 
 namespace BansheeEngine
 {
@@ -27,6 +28,11 @@ namespace BansheeEngine
 		 *							for the file type.
 		 *
 		 * @see		createImportOptions
+		 *
+		 * @note	If an import cache folder is set, and the contents of the input file and the import options
+		 *			match a previous import, the resource is loaded from the cache instead of being imported.
+		 *			Like a regular import, every such load returns a new resource. Resources referenced by the
+		 *			cached resource (e.g. font page textures) are shared between them however.
 		 */
 		HResource import(const Path& inputFilePath, ConstImportOptionsPtr importOptions = nullptr);
 
@@ -93,9 +99,61 @@ namespace BansheeEngine
 		 * 							want to remove an asset importer for the extension.
 		 */
 		void _registerAssetImporter(SpecificImporter* importer);
+
+		/**
+		 * @brief	Sets a folder in which imported resources are saved, keyed by a hash of their input file contents
+		 *			and import options. Subsequent imports of the same file with the same options load the saved resource
+		 *			instead of running the importer. Resources the imported resource references (e.g. font page textures)
+		 *			are saved along with it.
+		 *
+		 * @param	folder	Folder to store the cached resources in. The folder is created if it doesn't exist. 
+		 *					Provide an empty path to disable the cache.
+		 *
+		 * @note	Entries of a file are replaced when it is imported again after its contents or import options
+		 *			changed. Entries for files that are never imported again must be deleted manually if disk space 
+		 *			is a concern.
+		 */
+		void setImportCacheFolder(const Path& folder);
+
+		/**
+		 * @brief	Returns the folder imported resources are cached in, or an empty path if the cache is disabled.
+		 */
+		const Path& getImportCacheFolder() const { return mImportCacheFolder; }
 	private:
 		Vector<SpecificImporter*> mAssetImporters;
 
+		Path mImportCacheFolder;
+		ResourceManifestPtr mImportCacheManifest;
+
 		SpecificImporter* getImporterForFile(const Path& inputFilePath) const;
+
+		/**
+		 * @brief	Calculates a key uniquely identifying the import of the provided file with the provided options,
+		 *			including any external inputs reported by the importer.
+		 */
+		String getImportCacheKey(SpecificImporter* importer, const Path& inputFilePath, 
+			const ConstImportOptionsPtr& importOptions) const;
+
+		/**
+		 * @brief	Loads a new copy of the resource previously imported with the provided cache key. Returns 
+		 *			an empty handle if there is no such resource in the cache.
+		 */
+		HResource loadFromImportCache(const String& key);
+
+		/**
+		 * @brief	Saves a freshly imported resource, and any resources it references that aren't
+		 *			saved anywhere, to the import cache.
+		 */
+		void saveToImportCache(const String& key, const HResource& resource);
+
+		/**
+		 * @brief	Removes all import cache entries whose file names start with the provided prefix, 
+		 *			and deletes their files.
+		 */
+		void removeFromImportCache(const String& prefix);
+
+		static const WString IMPORT_CACHE_MANIFEST_NAME;
+		static const WString IMPORT_CACHE_EXTENSION;
+		static const UINT32 IMPORT_CACHE_VERSION;
 	};
 }
\ No newline at end of file
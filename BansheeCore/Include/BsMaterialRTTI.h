@@ -179,7 +179,7 @@ namespace BansheeEngine
 		virtual UINT32 getRTTIId() { return TID_MaterialParamFloat; }
 		virtual std::shared_ptr<IReflectable> newRTTIObject() 
 		{ 
-			return bs_shared_ptr<MaterialFloatParam, ScratchAlloc>(); 
+			return bs_shared_ptr<MaterialFloatParam, PoolAlloc>(); 
 		}
 	};
 
@@ -211,7 +211,7 @@ namespace BansheeEngine
 		virtual UINT32 getRTTIId() { return TID_MaterialParamVec2; }
 		virtual std::shared_ptr<IReflectable> newRTTIObject() 
 		{ 
-			return bs_shared_ptr<MaterialVec2Param, ScratchAlloc>(); 
+			return bs_shared_ptr<MaterialVec2Param, PoolAlloc>(); 
 		}
 	};
 
@@ -243,7 +243,7 @@ namespace BansheeEngine
 		virtual UINT32 getRTTIId() { return TID_MaterialParamVec3; }
 		virtual std::shared_ptr<IReflectable> newRTTIObject() 
 		{ 
-			return bs_shared_ptr<MaterialVec3Param, ScratchAlloc>(); 
+			return bs_shared_ptr<MaterialVec3Param, PoolAlloc>(); 
 		}
 	};
 
@@ -275,7 +275,7 @@ namespace BansheeEngine
 		virtual UINT32 getRTTIId() { return TID_MaterialParamVec4; }
 		virtual std::shared_ptr<IReflectable> newRTTIObject() 
 		{
-			return bs_shared_ptr<MaterialVec4Param, ScratchAlloc>();
+			return bs_shared_ptr<MaterialVec4Param, PoolAlloc>();
 		}
 	};
 
@@ -307,7 +307,7 @@ namespace BansheeEngine
 		virtual UINT32 getRTTIId() { return TID_MaterialParamMat3; }
 		virtual std::shared_ptr<IReflectable> newRTTIObject() 
 		{ 
-			return bs_shared_ptr<MaterialMat3Param, ScratchAlloc>();
+			return bs_shared_ptr<MaterialMat3Param, PoolAlloc>();
 		}
 	};
 
@@ -339,7 +339,7 @@ namespace BansheeEngine
 		virtual UINT32 getRTTIId() { return TID_MaterialParamMat4; }
 		virtual std::shared_ptr<IReflectable> newRTTIObject() 
 		{ 
-			return bs_shared_ptr<MaterialMat4Param, ScratchAlloc>();
+			return bs_shared_ptr<MaterialMat4Param, PoolAlloc>();
 		}
 	};
 
@@ -389,7 +389,7 @@ namespace BansheeEngine
 		virtual UINT32 getRTTIId() { return TID_MaterialParamStruct; }
 		virtual std::shared_ptr<IReflectable> newRTTIObject() 
 		{ 
-			return bs_shared_ptr<MaterialStructParam, ScratchAlloc>();
+			return bs_shared_ptr<MaterialStructParam, PoolAlloc>();
 		}
 	};
 
@@ -417,7 +417,7 @@ namespace BansheeEngine
 		virtual UINT32 getRTTIId() { return TID_MaterialParamTexture; }
 		virtual std::shared_ptr<IReflectable> newRTTIObject() 
 		{ 
-			return bs_shared_ptr<MaterialTextureParam, ScratchAlloc>();
+			return bs_shared_ptr<MaterialTextureParam, PoolAlloc>();
 		}
 	};
 
@@ -445,7 +445,7 @@ namespace BansheeEngine
 		virtual UINT32 getRTTIId() { return TID_MaterialParamSamplerState; }
 		virtual std::shared_ptr<IReflectable> newRTTIObject() 
 		{ 
-			return bs_shared_ptr<MaterialSamplerStateParam, ScratchAlloc>();
+			return bs_shared_ptr<MaterialSamplerStateParam, PoolAlloc>();
 		}
 	};
 
@@ -536,7 +536,7 @@ namespace BansheeEngine
 		virtual UINT32 getRTTIId() { return TID_MaterialParams; }
 		virtual std::shared_ptr<IReflectable> newRTTIObject() 
 		{ 
-			return bs_shared_ptr<MaterialParams, ScratchAlloc>();
+			return bs_shared_ptr<MaterialParams, PoolAlloc>();
 		}
 	};
 
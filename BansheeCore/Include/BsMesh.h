@@ -68,6 +68,11 @@ namespace BansheeEngine
 		 */
 		virtual IndexBufferPtr _getIndexBuffer() const;
 
+		/**
+		 * @copydoc	Resource::calculateSize
+		 */
+		UINT32 calculateSize() const;
+
 		/**
 		 * @brief	Returns a dummy mesh, containing just one triangle. Don't modify the returned mesh.
 		 */
@@ -36,8 +36,10 @@ namespace BansheeEngine
 
 		void setData(MeshData* obj, ManagedDataBlock val) 
 		{ 
-			// Nothing to do here, the pointer we provided already belongs to PixelData
-			// so the data is already written
+			// If the data is referenced in place (e.g. from a memory mapped file) use it directly.
+			// Otherwise the pointer we provided already belongs to MeshData so the data is already written.
+			if(val.getData() != obj->getData())
+				obj->setExternalBuffer(val.getData(), val.getDataOwner());
 		}
 
 		static UINT8* allocateData(MeshData* obj, UINT32 numBytes)
@@ -56,7 +58,7 @@ namespace BansheeEngine
 			addPlainField("mNumVertices", 2, &MeshDataRTTI::getNumVertices, &MeshDataRTTI::setNumVertices);
 			addPlainField("mNumIndices", 3, &MeshDataRTTI::getNumIndices, &MeshDataRTTI::setNumIndices);
 
-			addDataBlockField("data", 4, &MeshDataRTTI::getData, &MeshDataRTTI::setData, 0, &MeshDataRTTI::allocateData);
+			addDataBlockField("data", 4, &MeshDataRTTI::getData, &MeshDataRTTI::setData, RTTI_Flag_DataBlockView, &MeshDataRTTI::allocateData);
 		}
 
 		virtual std::shared_ptr<IReflectable> newRTTIObject() 
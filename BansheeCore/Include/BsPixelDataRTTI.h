@@ -47,8 +47,10 @@ namespace BansheeEngine
 
 		void setData(PixelData* obj, ManagedDataBlock val) 
 		{ 
-			// Nothing to do here, the pointer we provided already belongs to PixelData
-			// so the data is already written
+			// If the data is referenced in place (e.g. from a memory mapped file) use it directly.
+			// Otherwise the pointer we provided already belongs to PixelData so the data is already written.
+			if(val.getData() != obj->getData())
+				obj->setExternalBuffer(val.getData(), val.getDataOwner());
 		}
 
 		static UINT8* allocateData(PixelData* obj, UINT32 numBytes)
@@ -71,7 +73,7 @@ namespace BansheeEngine
 			addPlainField("slicePitch", 7, &PixelDataRTTI::getSlicePitch, &PixelDataRTTI::setSlicePitch);
 			addPlainField("format", 8, &PixelDataRTTI::getFormat, &PixelDataRTTI::setFormat);
 
-			addDataBlockField("data", 9, &PixelDataRTTI::getData, &PixelDataRTTI::setData, 0, &PixelDataRTTI::allocateData);
+			addDataBlockField("data", 9, &PixelDataRTTI::getData, &PixelDataRTTI::setData, RTTI_Flag_DataBlockView, &PixelDataRTTI::allocateData);
 		}
 
 		virtual const String& getRTTIName()
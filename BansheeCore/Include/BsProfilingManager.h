@@ -9,12 +9,22 @@
 
 namespace BansheeEngine
 {
+	/**
+	 * @brief	Contains memory usage information, as reported by the MemoryTracker.
+	 */
+	struct MemoryProfilerReport
+	{
+		MemoryCategoryStats categories[(UINT32)MemoryCategory::Count]; /**< Statistics for each allocator category, indexed by MemoryCategory. */
+		ProfilerVector<MemoryTagStats> tags; /**< Statistics for each registered allocation tag. */
+	};
+
 	/**
 	 * @brief	Contains data about a profiling session.
 	 */
 	struct ProfilerReport
 	{
 		CPUProfilerReport cpuReport;
+		MemoryProfilerReport memoryReport;
 	};
 
 	/**
@@ -27,7 +37,7 @@ namespace BansheeEngine
 	};
 
 	/**
-	 * @brief	Tracks CPU profiling information with each frame for sim and core threads.
+	 * @brief	Tracks CPU and memory profiling information with each frame for sim and core threads.
 	 *
 	 * @note	Sim thread only unless specified otherwise.
 	 */
@@ -60,6 +70,9 @@ namespace BansheeEngine
 		 *
 		 * @note	Profiler reports get updated every frame. Oldest reports that no longer fit in the saved reports buffer
 		 * 			are discarded.
+		 *
+		 *			Memory reports contain statistics for the entire process, not just the specified thread. Per frame
+		 *			memory statistics are measured between sim thread frames.
 		 */
 		const ProfilerReport& getReport(ProfiledThread thread, UINT32 idx = 0) const;
 
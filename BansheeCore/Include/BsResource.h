@@ -28,6 +28,12 @@ namespace BansheeEngine
 		 */
 		void setName(const String& name) { mName = name; }
 
+		/**
+		 * @brief	Returns the approximate amount of memory used by the resource data, in bytes.
+		 *			Used by Resources for memory accounting.
+		 */
+		virtual UINT32 calculateSize() const { return 0; }
+
 	protected:
 		friend class Resources;
 
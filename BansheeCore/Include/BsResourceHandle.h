@@ -4,6 +4,7 @@
 #pragma once
 
 #include "BsIReflectable.h"
+#include "BsUUID.h"
 
 namespace BansheeEngine
 {
@@ -16,12 +17,15 @@ namespace BansheeEngine
 	struct BS_CORE_EXPORT ResourceHandleData
 	{
 		ResourceHandleData()
-			:mIsCreated(false)
+			:mIsCreated(false), mIsLoadFailed(false), mIsEvicted(false), mLastUsed(0)
 		{ }
 
 		std::shared_ptr<Resource> mPtr;
-		String mUUID;
+		UUID mUUID;
 		bool mIsCreated;	
+		bool mIsLoadFailed; /**< Resource failed to load and never will be created. Guarded by the resource created mutex. */
+		std::atomic<bool> mIsEvicted; /**< Resource was unloaded to satisfy the memory budget, and will be reloaded once requested. */
+		std::atomic<UINT64> mLastUsed; /**< Resource use stamp at the time the resource was last accessed. */
 	};
 
 	/**
@@ -35,11 +39,22 @@ namespace BansheeEngine
 		/**
 		 * @brief	Checks if the resource is loaded. Until resource is loaded this handle
 		 *			is invalid and you may not get the internal resource from it.
+		 *
+		 * @note	If the resource was evicted to satisfy the resource memory budget this returns false.
+		 *			Accessing the resource or calling requestLoad starts reloading it asynchronously,
+		 *			while synchronize reloads it and waits until it is loaded.
 		 */
 		bool isLoaded() const;
 
 		/**
-		 * @brief	Blocks the current thread until the resource is fully loaded AND initialized.
+		 * @brief	Starts reloading the resource asynchronously if it was evicted to satisfy the resource 
+		 *			memory budget. Does nothing otherwise.
+		 */
+		void requestLoad() const;
+
+		/**
+		 * @brief	Blocks the current thread until the resource is fully loaded AND initialized, or until
+		 *			its load fails.
 		 * 			
 		 * @note	Careful not to call this on the thread that does the loading or initializing.
 		 */
@@ -48,7 +63,7 @@ namespace BansheeEngine
 		/**
 		 * @brief	Returns the UUID of the resource the handle is referring to.
 		 */
-		const String& getUUID() const { return mData != nullptr ? mData->mUUID : StringUtil::BLANK; }
+		const UUID& getUUID() const { return mData != nullptr ? mData->mUUID : UUID::EMPTY; }
 
 		/**
 		 * @brief	Gets the handle data. For internal use only.
@@ -64,7 +79,30 @@ namespace BansheeEngine
 		 *			multithreaded nature of resource loading.
 		 *			Internal method.
 		 */
-		void _setHandleData(std::shared_ptr<Resource> ptr, const String& uuid);
+		void _setHandleData(std::shared_ptr<Resource> ptr, const UUID& uuid);
+
+		/**
+		 * @brief	Marks the resource as failed to load, and wakes up any threads waiting for it in synchronize.
+		 *
+		 * @note	Internal method.
+		 */
+		void _notifyLoadFailed();
+
+		/**
+		 * @brief	Records that the resource was used at the current resource use stamp. Resources
+		 *			that weren't used for the longest time are evicted first.
+		 *
+		 * @note	Internal method. Called whenever the resource is accessed through a handle.
+		 */
+		void _markAsUsed() const;
+
+		/**
+		 * @brief	Advances the resource use stamp. Resources used between two advances are considered
+		 *			equally recently used, so handle data only needs to be written once per stamp.
+		 *
+		 * @note	Internal method. Called once per frame by Resources.
+		 */
+		static void _advanceUseStamp();
 
 	protected:
 		ResourceHandleBase();
@@ -109,7 +147,7 @@ namespace BansheeEngine
 		 * @brief	Constructs an invalid handle with the specified UUID. You must call _setHandleData
 		 *			with the actual resource pointer to make the handle valid.
 		 */
-		ResourceHandle(const String& uuid)
+		ResourceHandle(const UUID& uuid)
 			:ResourceHandleBase()
 		{
 			mData = bs_shared_ptr<ResourceHandleData, PoolAlloc>();
@@ -208,7 +246,7 @@ namespace BansheeEngine
 		 * @note	Handle will take ownership of the provided resource pointer, so make sure you don't
 		 *			delete it elsewhere.
 		 */
-		explicit ResourceHandle(T* ptr, const String& uuid)
+		explicit ResourceHandle(T* ptr, const UUID& uuid)
 			:ResourceHandleBase()
 		{
 			mData = bs_shared_ptr<ResourceHandleData, PoolAlloc>();
@@ -218,7 +256,7 @@ namespace BansheeEngine
 		/**
 		 * @brief	Constructs a new valid handle for the provided resource with the provided UUID.
 		 */
-		ResourceHandle(std::shared_ptr<T> ptr, const String& uuid)
+		ResourceHandle(std::shared_ptr<T> ptr, const UUID& uuid)
 			:ResourceHandleBase()
 		{
 			mData = bs_shared_ptr<ResourceHandleData, PoolAlloc>();
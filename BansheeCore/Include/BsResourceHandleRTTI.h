@@ -13,33 +13,35 @@ namespace BansheeEngine
 	class BS_CORE_EXPORT ResourceHandleRTTI : public RTTIType<ResourceHandleBase, IReflectable, ResourceHandleRTTI>
 	{
 	private:
-		String& getUUID(ResourceHandleBase* obj) 
+		UUID& getUUID(ResourceHandleBase* obj) 
 		{ 
-			static String Blank = "";
+			static UUID Blank;
 
 			return obj->mData != nullptr ? obj->mData->mUUID : Blank; 
 		}
 
-		void setUUID(ResourceHandleBase* obj, String& uuid) { obj->mData->mUUID = uuid; } 
+		void setUUID(ResourceHandleBase* obj, UUID& uuid) { obj->mData->mUUID = uuid; } 
 	public:
 		ResourceHandleRTTI()
 		{
 			addPlainField("mUUID", 0, &ResourceHandleRTTI::getUUID, &ResourceHandleRTTI::setUUID);
 		}
 
-		void onDeserializationEnded(IReflectable* obj)
+		void onSerializationStarted(IReflectable* obj, SerializationContext* context)
 		{
-			ResourceHandleBase* resourceHandle = static_cast<ResourceHandleBase*>(obj);
+			// When saving a resource, record the referenced resource as its dependency
+			ResourceSaveContext* saveContext = dynamic_cast<ResourceSaveContext*>(context);
+			if(saveContext == nullptr)
+				return;
 
-			if(resourceHandle->mData && resourceHandle->mData->mUUID != "")
-			{
-				// NOTE: This will cause Resources::load to be called recursively with resources that contain other
-				// resources. This might cause problems. Keep this note here as a warning until I prove otherwise.
-				HResource loadedResource = gResources().loadFromUUID(resourceHandle->mData->mUUID);
+			ResourceHandleBase* resourceHandle = static_cast<ResourceHandleBase*>(obj);
+			saveContext->addDependency(resourceHandle->getUUID());
+		}
 
-				if(loadedResource)
-					resourceHandle->_setHandleData(loadedResource.getInternalPtr(), resourceHandle->mData->mUUID);
-			}
+		void onDeserializationEnded(IReflectable* obj)
+		{
+			ResourceHandleBase* resourceHandle = static_cast<ResourceHandleBase*>(obj);
+			gResources()._resolveDeserializedHandle(*resourceHandle);
 		}
 
 		virtual const String& getRTTIName()
@@ -6,6 +6,7 @@
 #include "BsCorePrerequisites.h"
 #include "BsIReflectable.h"
 #include "BsPath.h"
+#include "BsUUID.h"
 
 namespace BansheeEngine
 {
@@ -34,35 +35,40 @@ namespace BansheeEngine
 		/**
 		 * @brief	Registers a new resource in the manifest.
 		 */
-		void registerResource(const String& uuid, const Path& filePath);
+		void registerResource(const UUID& uuid, const Path& filePath);
 
 		/**
 		 * @brief	Removes a resource from the manifest.
 		 */
-		void unregisterResource(const String& uuid);
+		void unregisterResource(const UUID& uuid);
 
 		/**
 		 * @brief	Attempts to find a resource with the provided UUID and outputs the path
 		 *			to the resource if found. Returns true if UUID was found, false otherwise.
 		 */
-		bool uuidToFilePath(const String& uuid, Path& filePath) const;
+		bool uuidToFilePath(const UUID& uuid, Path& filePath) const;
 
 		/**
 		 * @brief	Attempts to find a resource with the provided path and outputs the UUID
 		 *			to the resource if found. Returns true if path was found, false otherwise.
 		 */
-		bool filePathToUUID(const Path& filePath, String& outUUID) const;
+		bool filePathToUUID(const Path& filePath, UUID& outUUID) const;
 
 		/**
 		 * @brief	Checks if provided UUID exists in the manifest.
 		 */
-		bool uuidExists(const String& uuid) const;
+		bool uuidExists(const UUID& uuid) const;
 
 		/**
 		 * @brief	Checks if the provided path exists in the manifest.
 		 */
 		bool filePathExists(const Path& filePath) const;
 
+		/**
+		 * @brief	Returns all entries in the manifest, mapping resource UUIDs to their file paths.
+		 */
+		const UnorderedMap<UUID, Path>& getEntries() const { return mUUIDToFilePath; }
+
 		/**
 		 * @brief	Saves the resource manifest to the specified location.
 		 *
@@ -90,8 +96,8 @@ namespace BansheeEngine
 
 	private:
 		String mName;
-		UnorderedMap<String, Path> mUUIDToFilePath;
-		UnorderedMap<Path, String> mFilePathToUUID;
+		UnorderedMap<UUID, Path> mUUIDToFilePath;
+		UnorderedMap<Path, UUID> mFilePathToUUID;
 
 		/************************************************************************/
 		/* 								RTTI		                     		*/
@@ -23,12 +23,12 @@ namespace BansheeEngine
 			obj->mName = val;
 		}
 
-		UnorderedMap<String, Path>& getUUIDMap(ResourceManifest* obj)
+		UnorderedMap<UUID, Path>& getUUIDMap(ResourceManifest* obj)
 		{ 
 			return obj->mUUIDToFilePath;
 		}
 
-		void setUUIDMap(ResourceManifest* obj, UnorderedMap<String, Path>& val)
+		void setUUIDMap(ResourceManifest* obj, UnorderedMap<UUID, Path>& val)
 		{ 
 			obj->mUUIDToFilePath = val; 
 
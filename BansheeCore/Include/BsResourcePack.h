@@ -0,0 +1,120 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsResources.h"
+#include "BsPath.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	A single file containing many serialized resources, indexed by their UUIDs. Avoids
+	 *			the cost of opening and seeking a separate file for every resource.
+	 *
+	 *			Pack starts with a header, followed by resource data and a table of entries sorted
+	 *			by UUID. Resource data is stored as written by FileSerializer, either as is or compressed 
+	 *			as a whole, and starts at an offset aligned to BinarySerializer::DATA_BLOCK_ALIGNMENT so 
+	 *			it can be used in place when memory mapped. Meta data of a resource is stored separately 
+	 *			after its data and is never compressed, so it can be read without decompressing the resource.
+	 *
+	 * @note	Pack file is memory mapped and remains open for as long as the pack, or any resource
+	 *			data referencing it, exists.
+	 *
+	 *			Thread safe.
+	 */
+	class BS_CORE_EXPORT ResourcePack
+	{
+	public:
+		/**
+		 * @brief	Opens the pack file at the provided location. Throws an exception if the file is
+		 *			not a valid pack.
+		 */
+		ResourcePack(const Path& filePath);
+
+		/**
+		 * @brief	Returns the location of the pack file.
+		 */
+		const Path& getPath() const { return mPath; }
+
+		/**
+		 * @brief	Checks if the pack contains a resource with the provided UUID.
+		 */
+		bool contains(const UUID& uuid) const;
+
+		/**
+		 * @brief	Deserializes the resource with the provided UUID. Returns null if the pack
+		 *			doesn't contain the resource.
+		 *
+		 * @param	uuid		UUID of the resource to decode.
+		 * @param	loadMode	Determines if data of an uncompressed resource is copied or referenced in place.
+		 */
+		std::shared_ptr<IReflectable> decode(const UUID& uuid, ResourceLoadMode loadMode) const;
+
+		/**
+		 * @brief	Deserializes the meta data stored with the resource with the provided UUID. Returns null
+		 *			if the pack doesn't contain the resource or the resource has no meta data.
+		 *
+		 * @see		FileSerializer::decodeMetaData
+		 */
+		std::shared_ptr<IReflectable> decodeMetaData(const UUID& uuid) const;
+
+		/**
+		 * @brief	Builds a pack containing all resources in the provided manifest. Resource files
+		 *			that don't exist are skipped.
+		 *
+		 * @param	manifest	Manifest whose resources to pack.
+		 * @param	filePath	Location to write the pack to. Any existing file will be overwritten.
+		 * @param	compress	(optional) If true, resources are compressed individually. Resources that
+		 *						don't compress well are stored uncompressed regardless.
+		 */
+		static void create(const ResourceManifestPtr& manifest, const Path& filePath, bool compress = false);
+
+	private:
+		/**
+		 * @brief	Header at the start of the pack file.
+		 */
+		struct Header
+		{
+			UINT32 magic;
+			UINT32 version;
+			UINT32 numEntries;
+			UINT32 padding;
+			UINT64 entryTableOffset;
+		};
+
+		/**
+		 * @brief	Describes a single resource in the pack. Resource is compressed if its size
+		 *			differs from its uncompressed size.
+		 */
+		struct Entry
+		{
+			UINT64 offset;
+			UINT64 size;
+			UINT64 uncompressedSize;
+			UINT64 metaDataOffset;
+			UINT64 metaDataSize; /**< Zero if the resource has no meta data. */
+			UUID uuid;
+		};
+
+		/**
+		 * @brief	Finds an entry for the resource with the provided UUID using a binary search
+		 *			over the sorted entry table. Returns null if not found.
+		 */
+		const Entry* findEntry(const UUID& uuid) const;
+
+		Path mPath;
+		MemoryMappedFilePtr mFile;
+
+		const Entry* mEntries;
+		UINT32 mNumEntries;
+
+		/************************************************************************/
+		/* 								CONSTANTS	                     		*/
+		/************************************************************************/
+	private:
+		static const UINT32 PACK_MAGIC = 0x4B505342; // "BSPK"
+		static const UINT32 PACK_VERSION = 3;
+	};
+}
\ No newline at end of file
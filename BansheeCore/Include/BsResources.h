@@ -5,9 +5,73 @@
 
 #include "BsCorePrerequisites.h"
 #include "BsModule.h"
+#include "BsRTTIType.h"
+#include "BsUUID.h"
 
 namespace BansheeEngine
 {
+	/**
+	 * @brief	Determines how is resource data read from disk when loading a resource.
+	 */
+	enum class ResourceLoadMode
+	{
+		/**
+		 * Resource file is streamed from disk, and all of its data is copied into memory owned by the resource.
+		 */
+		Stream,
+		/**
+		 * Resource file is memory mapped. Large data blocks (e.g. texture pixels or mesh vertices) reference the
+		 * mapped memory directly without being copied, and keep the file mapped while they are in use. The file
+		 * remains open while the mapping exists, so it cannot be modified until the data is released.
+		 */
+		MemoryMapped
+	};
+
+	/**
+	 * @brief	Determines when can a resource be evicted in order to keep resource memory usage within the budget.
+	 *			Only resources that can be reloaded (i.e. are saved in a resource manifest or a mounted pack) and
+	 *			whose data isn't referenced outside of resource handles are ever evicted.
+	 *
+	 * @see		Resources::setMemoryBudget
+	 */
+	enum class ResourcePriority
+	{
+		/**
+		 * Resource can be evicted even while handles to it exist. Accessing it through a handle starts reloading it
+		 * asynchronously, and ResourceHandleBase::synchronize reloads it and waits until it is loaded.
+		 */
+		Low,
+		/**
+		 * Resource can be evicted once there are no handles to it.
+		 */
+		Normal,
+		/**
+		 * Resource is never evicted.
+		 */
+		High
+	};
+
+	/**
+	 * @brief	Serialization context used when saving a resource. Resource handles encountered while the resource
+	 *			is being encoded record the resources they reference as its dependencies.
+	 *
+	 * @note	Thread safe, as objects of a resource may be encoded on multiple threads.
+	 */
+	class BS_CORE_EXPORT ResourceSaveContext : public SerializationContext
+	{
+	public:
+		ResourceSaveContext(SavedResourceData& resourceData);
+
+		/**
+		 * @brief	Records the resource with the provided UUID as a dependency of the resource being saved.
+		 */
+		void addDependency(const UUID& uuid);
+
+	private:
+		SavedResourceData& mResourceData;
+		BS_MUTEX(mMutex);
+	};
+
 	/**
 	 * @brief	Manager for dealing with all engine resources. It allows you to save 
 	 *			new resources and load existing ones.
@@ -26,16 +90,19 @@ namespace BansheeEngine
 		/**
 		 * @brief	Loads the resource from a given path. Returns an empty handle if resource can't be loaded.
 		 *			Resource is loaded synchronously.
+		 *
+		 * @param	filePath	Full pathname of the file.
+		 * @param	loadMode	(optional) Determines how is the resource data read from disk.
 		 */
-		HResource load(const Path& filePath);
+		HResource load(const Path& filePath, ResourceLoadMode loadMode = ResourceLoadMode::Stream);
 
 		/**
 		 * @copydoc	load
 		 */
 		template <class T>
-		ResourceHandle<T> load(const Path& filePath)
+		ResourceHandle<T> load(const Path& filePath, ResourceLoadMode loadMode = ResourceLoadMode::Stream)
 		{
-			return static_resource_cast<T>(load(filePath));
+			return static_resource_cast<T>(load(filePath, loadMode));
 		}
 
 		/**
@@ -43,37 +110,49 @@ namespace BansheeEngine
 		 *			until resource loading is done.
 		 *
 		 * @param	filePath	Full pathname of the file.
+		 * @param	loadMode	(optional) Determines how is the resource data read from disk.
 		 * 						
 		 * @note	You can use returned invalid handle in engine systems as the engine will check for handle 
 		 *			validity before using it.
+		 *
+		 *			All resources the resource depends on are loaded in parallel with it, and the returned handle
+		 *			only becomes valid once they are all loaded.
 		 */
-		HResource loadAsync(const Path& filePath);
+		HResource loadAsync(const Path& filePath, ResourceLoadMode loadMode = ResourceLoadMode::Stream);
 
 		/**
 		 * @copydoc	loadAsync
 		 */
 		template <class T>
-		ResourceHandle<T> loadAsync(const Path& filePath)
+		ResourceHandle<T> loadAsync(const Path& filePath, ResourceLoadMode loadMode = ResourceLoadMode::Stream)
 		{
-			return static_resource_cast<T>(loadAsync(filePath));
+			return static_resource_cast<T>(loadAsync(filePath, loadMode));
 		}
 
 		/**
 		 * @brief	Loads the resource with the given UUID. Returns an empty handle if resource can't be loaded.
 		 *			Resource is loaded synchronously.
+		 *
+		 * @param	uuid		UUID of the resource to load.
+		 * @param	loadMode	(optional) Determines how is the resource data read from disk.
+		 *
+		 * @note	Mounted resource packs are searched before resource manifests.
 		 */
-		HResource loadFromUUID(const String& uuid);
+		HResource loadFromUUID(const UUID& uuid, ResourceLoadMode loadMode = ResourceLoadMode::Stream);
 
 		/**
 		 * @brief	Loads the resource with the given UUID asynchronously. Initially returned resource handle will be invalid
 		 *			until resource loading is done.
 		 *
-		 * @param	uuid	UUID of the resource to load. 
+		 * @param	uuid		UUID of the resource to load. 
+		 * @param	loadMode	(optional) Determines how is the resource data read from disk.
 		 *
 		 * @note	You can use returned invalid handle in engine systems as the engine will check for handle
 		 *			validity before using it.
+		 *
+		 *			Mounted resource packs are searched before resource manifests.
 		 */
-		HResource loadFromUUIDAsync(const String& uuid);
+		HResource loadFromUUIDAsync(const UUID& uuid, ResourceLoadMode loadMode = ResourceLoadMode::Stream);
 
 		/**
 		 * @brief	Unloads the resource that is referenced by the handle. 
@@ -90,6 +169,46 @@ namespace BansheeEngine
 		 */
 		void unloadAllUnused();
 
+		/**
+		 * @brief	Sets the maximum amount of memory, in bytes, that loaded resources should use. When usage exceeds 
+		 *			the budget, least recently used resources are evicted until it doesn't, as allowed by their priority.
+		 *			Budget is enforced once per frame. Zero means no budget, which is the default.
+		 *
+		 * @see		ResourcePriority
+		 */
+		void setMemoryBudget(UINT64 budget) { mMemoryBudget = budget; }
+
+		/**
+		 * @brief	Returns the maximum amount of memory, in bytes, that loaded resources should use.
+		 *			Zero means there is no budget.
+		 */
+		UINT64 getMemoryBudget() const { return mMemoryBudget; }
+
+		/**
+		 * @brief	Returns the approximate amount of memory used by all loaded resources, in bytes.
+		 */
+		UINT64 getMemoryUsage() const;
+
+		/**
+		 * @brief	Returns the approximate amount of memory used by loaded resources of a specific type, in bytes.
+		 *
+		 * @param	typeId	RTTI type id of the resource type (e.g. TID_Texture).
+		 */
+		UINT64 getMemoryUsage(UINT32 typeId) const;
+
+		/**
+		 * @brief	Determines when can the resource be evicted to satisfy the memory budget. The priority is kept
+		 *			even if the resource is unloaded, and applies to it once it is loaded again.
+		 */
+		void setPriority(const HResource& resource, ResourcePriority priority);
+
+		/**
+		 * @brief	Evicts least recently used resources if resource memory usage is over the budget.
+		 *
+		 * @note	Internal method. Called once per frame by the application.
+		 */
+		void _update();
+
 		/**
 		 * @brief	Saves the resource at the specified location.
 		 *
@@ -97,6 +216,9 @@ namespace BansheeEngine
 		 * @param	filePath 	Full pathname of the file to save as.
 		 * @param	overwrite	(optional) If true, any existing resource at the specified location will
 		 * 						be overwritten.
+		 * @param	parallel	(optional) If true, objects the resource consists of are encoded in parallel.
+		 *						RTTI types of all the objects must support being serialized from multiple threads
+		 *						at once. See BinarySerializer::encode.
 		 * 						
 		 * @note	If the resource is a GpuResource and you are in some way modifying it from the Core thread, make
 		 * 			sure all those commands are submitted before you call this method. Otherwise an obsolete
@@ -105,7 +227,7 @@ namespace BansheeEngine
 		 *			If saving a core thread resource this is a potentially very slow operation as we must wait on the 
 		 *			core thread and the GPU in order to read the resource.
 		 */
-		void save(HResource resource, const Path& filePath, bool overwrite);
+		void save(HResource resource, const Path& filePath, bool overwrite, bool parallel = false);
 
 		/**
 		 * @brief	Creates a new resource handle from a resource pointer. 
@@ -114,6 +236,21 @@ namespace BansheeEngine
 		 */
 		HResource _createResourceHandle(const ResourcePtr& obj);
 
+		/**
+		 * @brief	Returns a handle to the resource with the provided UUID if it is loaded, or an
+		 *			empty handle otherwise. Resources that are still being loaded are not returned.
+		 */
+		HResource getLoadedResource(const UUID& uuid) const;
+
+		/**
+		 * @brief	Points a freshly deserialized resource handle to the resource it references. If a resource is
+		 *			being loaded on this thread, the referenced resource is loaded in parallel with it and the handle
+		 *			is resolved once it finishes loading. Otherwise the referenced resource is loaded synchronously.
+		 *
+		 * @note	Internal method called by resource handle RTTI.
+		 */
+		void _resolveDeserializedHandle(ResourceHandleBase& handle);
+
 		/**
 		 * @brief	Allows you to set a resource manifest containing UUID <-> file path mapping that is
 		 * 			used when resolving resource references.
@@ -136,44 +273,154 @@ namespace BansheeEngine
 		 */
 		ResourceManifestPtr getResourceManifest(const String& name) const;
 
+		/**
+		 * @brief	Mounts a resource pack, allowing resources it contains to be loaded by their UUIDs. If multiple
+		 *			mounted packs contain the same resource, the most recently mounted pack is used.
+		 *
+		 * @param	filePath	Full pathname of the pack file.
+		 *
+		 * @see		ResourcePack
+		 */
+		void mountPack(const Path& filePath);
+
+		/**
+		 * @brief	Unmounts a previously mounted resource pack. Resources already loaded from the
+		 *			pack are not affected.
+		 */
+		void unmountPack(const Path& filePath);
+
 		/**
 		 * @brief	Attempts to retrieve file path from the provided UUID. Returns true
 		 *			if successful, false otherwise.
 		 */
-		bool getFilePathFromUUID(const String& uuid, Path& filePath) const;
+		bool getFilePathFromUUID(const UUID& uuid, Path& filePath) const;
 
 		/**
 		 * @brief	Attempts to retrieve UUID from the provided file path. Returns true
 		 *			if successful, false otherwise.
 		 */
-		bool getUUIDFromFilePath(const Path& path, String& uuid) const;
+		bool getUUIDFromFilePath(const Path& path, UUID& uuid) const;
 
 	private:
 		/**
 		 * @brief	Starts resource loading or returns an already loaded resource.
 		 */
-		HResource loadInternal(const Path& filePath, bool synchronous);
+		HResource loadInternal(const Path& filePath, bool synchronous, ResourceLoadMode loadMode);
+
+		/**
+		 * @brief	Starts resource loading or returns an already loaded resource. Resource is
+		 *			read from the provided pack, or from the provided file if the pack is null.
+		 */
+		HResource loadInternal(const UUID& uuid, const Path& filePath, const ResourcePackPtr& pack, 
+			bool synchronous, ResourceLoadMode loadMode);
+
+		/**
+		 * @brief	Performs actually reading and deserializing of the resource from the provided pack, memory
+		 *			mapped file or file stream, whichever is first not null. Called from various worker threads.
+		 */
+		ResourcePtr loadFromDiskAndDeserialize(const UUID& uuid, const ResourcePackPtr& pack, 
+			const MemoryMappedFilePtr& mappedFile, const DataStreamPtr& stream, ResourceLoadMode loadMode);
+
+		/**
+		 * @brief	Callback triggered when the task manager is ready to process the loading task. Starts 
+		 *			loading dependencies of the resource, loads the resource and waits until its dependencies
+		 *			are loaded. Dependencies whose loads are waiting on this resource (cyclic references) are not
+		 *			waited on, and their handles to this resource are resolved once it is loaded instead.
+		 *
+		 * @note	If the load fails the exception is rethrown for synchronous loads, and logged otherwise.
+		 */
+		void loadCallback(const Path& filePath, const ResourcePackPtr& pack, HResource& resource, 
+			ResourceLoadMode loadMode, bool synchronous);
 
 		/**
-		 * @brief	Performs actually reading and deserializing of the resource file. 
-		 *			Called from various worker threads.
+		 * @brief	Stops tracking a load that finished or failed. Returns handles that were waiting to be
+		 *			resolved once the resource is loaded.
 		 */
-		ResourcePtr loadFromDiskAndDeserialize(const Path& filePath);
+		Vector<HResource> finishLoad(const UUID& uuid, const UUID* waitingLoad);
 
 		/**
-		 * @brief	Callback triggered when the task manager is ready to process the loading task.
+		 * @brief	Returns the most recently mounted pack containing the resource with the provided UUID,
+		 *			or null if none does.
 		 */
-		void loadCallback(const Path& filePath, HResource& resource);
+		ResourcePackPtr findPack(const UUID& uuid) const;
+
+		/**
+		 * @brief	Blocks the load of the resource with UUID "waitingLoad" until the provided resource is loaded. 
+		 *			If the resource is being loaded asynchronously the calling thread executes other tasks while 
+		 *			it waits. Returns immediately if the resource's load is itself waiting on "waitingLoad".
+		 */
+		void waitUntilLoaded(const UUID& waitingLoad, const HResource& resource);
+
+		/**
+		 * @brief	Checks if a load is waiting on another load, either directly or through other loads. Caller must
+		 *			hold the in progress resources mutex.
+		 */
+		bool isLoadWaitingOn(const UUID& load, const UUID& otherLoad) const;
+
+		/**
+		 * @brief	Points the handle to the provided resource. If the resource is still loading, the handle is
+		 *			resolved once it finishes loading.
+		 */
+		void resolveWhenLoaded(HResource& handle, const HResource& resource);
+
+		/**
+		 * @brief	Adds a freshly loaded resource to the memory usage. Caller must hold the loaded resource mutex.
+		 */
+		void addResident(const UUID& uuid, const ResourcePtr& resource);
+
+		/**
+		 * @brief	Removes an unloaded resource from the memory usage. Caller must hold the loaded resource mutex.
+		 */
+		void removeResident(const UUID& uuid);
+
+		/**
+		 * @brief	Unloads a resource to satisfy the memory budget. Existing handles to the resource are kept
+		 *			and start reloading the resource when next accessed. Does nothing if the resource was unloaded or 
+		 *			can no longer be evicted.
+		 */
+		void evict(const HResource& resource);
+
+		/**
+		 * @brief	Checks if the priority and the references to a loaded resource allow it to be evicted.
+		 *			Caller must hold the loaded resource mutex.
+		 *
+		 * @param	resource			Handle to the resource.
+		 * @param	numInternalHandles	Number of handles to the resource held by the resource manager itself,
+		 *								which don't count as the resource being in use.
+		 */
+		bool isEvictable(const HResource& resource, UINT32 numInternalHandles) const;
+
+		/**
+		 * @brief	Memory usage information about a loaded resource.
+		 */
+		struct ResidencyInfo
+		{
+			UINT32 size;
+			UINT32 typeId;
+		};
 
 	private:
 		Vector<ResourceManifestPtr> mResourceManifests;
 		ResourceManifestPtr mDefaultResourceManifest;
+		Vector<ResourcePackPtr> mResourcePacks;
+
+		BS_MUTEX(mResourcePacksMutex);
 
 		BS_MUTEX(mInProgressResourcesMutex);
 		BS_MUTEX(mLoadedResourceMutex);
 
-		UnorderedMap<String, HResource> mLoadedResources;
-		UnorderedMap<String, HResource> mInProgressResources; // Resources that are being asynchronously loaded
+		UnorderedMap<UUID, HResource> mLoadedResources;
+		UnorderedMap<UUID, HResource> mInProgressResources; // Resources that are being asynchronously loaded
+		UnorderedMap<UUID, TaskPtr> mLoadTasks; // Tasks loading the resources in mInProgressResources, if loaded asynchronously
+		UnorderedMap<UUID, Vector<UUID>> mLoadWaits; // Loads that must finish before the load of the key resource can continue
+		UnorderedMap<UUID, Vector<HResource>> mDeferredHandles; // Handles to resolve once the key resource is done loading
+
+		UnorderedMap<UUID, ResidencyInfo> mResidencyInfo; // Guarded by mLoadedResourceMutex
+		UnorderedMap<UUID, HResource> mEvictedResources; // Evicted resources that still have handles. Guarded by mLoadedResourceMutex
+		UnorderedMap<UUID, ResourcePriority> mPriorities; // Guarded by mLoadedResourceMutex
+		UnorderedMap<UINT32, UINT64> mMemoryUsagePerType; // Guarded by mLoadedResourceMutex
+		UINT64 mMemoryUsage;
+		UINT64 mMemoryBudget;
 	};
 
 	/**
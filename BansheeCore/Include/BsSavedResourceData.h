@@ -0,0 +1,42 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsIReflectable.h"
+#include "BsUUID.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Contains information about a saved resource that can be read without loading the resource
+	 *			itself. Stored as meta data in resource files.
+	 */
+	class BS_CORE_EXPORT SavedResourceData : public IReflectable
+	{
+	public:
+		SavedResourceData();
+
+		/**
+		 * @brief	Registers a resource the saved resource depends on. Duplicate UUIDs are ignored.
+		 */
+		void addDependency(const UUID& uuid);
+
+		/**
+		 * @brief	Returns UUIDs of all resources the saved resource depends on.
+		 */
+		const Vector<UUID>& getDependencies() const { return mDependencies; }
+
+	private:
+		Vector<UUID> mDependencies;
+
+		/************************************************************************/
+		/* 								SERIALIZATION                      		*/
+		/************************************************************************/
+	public:
+		friend class SavedResourceDataRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		virtual RTTITypeBase* getRTTI() const;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsRTTIType.h"
+#include "BsSavedResourceData.h"
+
+namespace BansheeEngine
+{
+	class BS_CORE_EXPORT SavedResourceDataRTTI : public RTTIType<SavedResourceData, IReflectable, SavedResourceDataRTTI>
+	{
+	private:
+		UUID& getDependency(SavedResourceData* obj, UINT32 arrayIdx) { return obj->mDependencies[arrayIdx]; }
+		void setDependency(SavedResourceData* obj, UINT32 arrayIdx, UUID& value) { obj->mDependencies[arrayIdx] = value; }
+		UINT32 getNumDependencies(SavedResourceData* obj) { return (UINT32)obj->mDependencies.size(); }
+		void setNumDependencies(SavedResourceData* obj, UINT32 numEntries) { obj->mDependencies.resize(numEntries); }
+
+	public:
+		SavedResourceDataRTTI()
+		{
+			addPlainArrayField("mDependencies", 0, &SavedResourceDataRTTI::getDependency, &SavedResourceDataRTTI::getNumDependencies, 
+				&SavedResourceDataRTTI::setDependency, &SavedResourceDataRTTI::setNumDependencies);
+		}
+
+		virtual const String& getRTTIName()
+		{
+			static String name = "SavedResourceData";
+			return name;
+		}
+
+		virtual UINT32 getRTTIId()
+		{
+			return TID_SavedResourceData;
+		}
+
+		virtual std::shared_ptr<IReflectable> newRTTIObject()
+		{
+			return bs_shared_ptr<SavedResourceData, PoolAlloc>();
+		}
+	};
+}
\ No newline at end of file
@@ -304,6 +304,13 @@ namespace BansheeEngine
 		 */
 		HSceneObject clone();
 
+		/**
+		 * @brief	Makes a deep copy of this object, using the provided serializer for the intermediate data. 
+		 *			Reuse the same serializer when making many copies (e.g. undo snapshots), so the intermediate 
+		 *			buffer is only allocated when it needs to grow.
+		 */
+		HSceneObject clone(MemorySerializer& serializer);
+
 	private:
 		HSceneObject mParent;
 		Vector<HSceneObject> mChildren;
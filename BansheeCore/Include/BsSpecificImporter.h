@@ -49,6 +49,16 @@ namespace BansheeEngine
 		 */
 		virtual ImportOptionsPtr createImportOptions() const;
 
+		/**
+		 * @brief	Retrieves contents of any inputs the import depends on, other than the imported file and the
+		 *			import options themselves (e.g. files included by the imported file). Used by the import cache
+		 *			to detect when the inputs change.
+		 *
+		 * @param	importOptions	Options the file is being imported with.
+		 * @param	contents		Contents of the inputs, appended by the method.
+		 */
+		virtual void getExternalInputs(const ConstImportOptionsPtr& importOptions, Vector<String>& contents) const { }
+
 		/**
 		 * @brief	Gets the default import options.
 		 *
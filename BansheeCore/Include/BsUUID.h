@@ -3,40 +3,116 @@
 //________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
 #pragma once
 
-#include "BsCorePrerequisites.h"
-#include "BsModule.h"
-#include "BsSpinLock.h"
-#include <random>
+#include "BsPrerequisitesUtil.h"
+#include "BsUtil.h"
 
 namespace BansheeEngine
 {
 	/**
-	 * @brief	Utility class for generating universally unique identifiers.
-	 *
-	 * @note	Thread safe.
+	 * @brief	Universally unique identifier stored as 16 bytes. Cheap to copy, compare and hash.
+	 *			Converted to its 36 character string form only for serialization and display.
 	 */
-	class BS_CORE_EXPORT UUIDGenerator : public Module<UUIDGenerator>
+	class BS_CORE_EXPORT UUID
 	{
+	public:
 		/**
-		 * @brief	Type of UUID generation to use.
+		 * @brief	Constructs an empty UUID.
 		 */
-		enum UUIDVersion
+		UUID()
 		{
-			UUIDV_TimeBased = 0x01
-		};
+			memset(mData, 0, sizeof(mData));
+		}
 
-	public:
-		UUIDGenerator();
+		/**
+		 * @brief	Constructs an UUID from its string form (e.g. "f81d4fae-7dec-11d0-a765-00a0c91e6bf6"). 
+		 *			Constructs an empty UUID if the string is not a valid UUID.
+		 */
+		explicit UUID(const String& uuid);
+
+		bool operator==(const UUID& rhs) const
+		{
+			return mData[0] == rhs.mData[0] && mData[1] == rhs.mData[1] && mData[2] == rhs.mData[2] && mData[3] == rhs.mData[3];
+		}
+
+		bool operator!=(const UUID& rhs) const
+		{
+			return !(*this == rhs);
+		}
+
+		bool operator<(const UUID& rhs) const
+		{
+			for(UINT32 i = 0; i < 4; i++)
+			{
+				if(mData[i] != rhs.mData[i])
+					return mData[i] < rhs.mData[i];
+			}
+
+			return false;
+		}
+
+		/**
+		 * @brief	Checks if the UUID is empty, i.e. doesn't identify anything.
+		 */
+		bool empty() const
+		{
+			return mData[0] == 0 && mData[1] == 0 && mData[2] == 0 && mData[3] == 0;
+		}
 
 		/**
-		 * @brief	Generate a new random universally unique identifier.
+		 * @brief	Converts the UUID to its string form. Empty UUID is converted to an empty string.
 		 */
-		String generateRandom();
+		String toString() const;
+
+		static const UUID EMPTY;
 
 	private:
-		std::mt19937 mRandomGenerator;
-		MACAddress mMACAddress;
-		SpinLock mSpinLock;
-		bool mHaveMacAddress;
+		friend class UUIDGenerator;
+		friend struct ::std::hash<BansheeEngine::UUID>;
+
+		UINT32 mData[4];
+	};
+
+	/**
+	 * @brief	RTTIPlainType specialization for UUID that allows it to be serialized. UUID is stored in 
+	 *			its string form, exactly as a String containing it would be.
+	 */
+	template<> struct RTTIPlainType<UUID>
+	{	
+		enum { id = TID_UUID }; enum { hasDynamicSize = 1 };
+
+		static void toMemory(const UUID& data, char* memory)
+		{ 
+			RTTIPlainType<String>::toMemory(data.toString(), memory);
+		}
+
+		static UINT32 fromMemory(UUID& data, char* memory)
+		{ 
+			String uuid;
+			UINT32 size = RTTIPlainType<String>::fromMemory(uuid, memory);
+
+			data = UUID(uuid);
+			return size;
+		}
+
+		static UINT32 getDynamicSize(const UUID& data)	
+		{ 
+			return RTTIPlainType<String>::getDynamicSize(data.toString());
+		}	
 	};
-}
\ No newline at end of file
+}
+
+/**
+ * @brief	Hash value generator for UUID.
+ */
+template<>
+struct std::hash<BansheeEngine::UUID>
+{
+	size_t operator()(const BansheeEngine::UUID& value) const
+	{
+		size_t hash = 0;
+		for(BansheeEngine::UINT32 i = 0; i < 4; i++)
+			BansheeEngine::hash_combine(hash, value.mData[i]);
+
+		return hash;
+	}
+};
\ No newline at end of file
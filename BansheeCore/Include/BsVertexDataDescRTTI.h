@@ -36,7 +36,8 @@ namespace BansheeEngine
 		VertexDataDescRTTI()
 		{
 			addPlainArrayField("mVertexData", 0, &VertexDataDescRTTI::getVertexElementData, 
-				&VertexDataDescRTTI::getNumVertexElementData, &VertexDataDescRTTI::setVertexElementData, &VertexDataDescRTTI::setNumVertexElementData);
+				&VertexDataDescRTTI::getNumVertexElementData, &VertexDataDescRTTI::setVertexElementData, 
+				&VertexDataDescRTTI::setNumVertexElementData, RTTI_Flag_ContiguousArray);
 		}
 
 		virtual std::shared_ptr<IReflectable> newRTTIObject() 
@@ -105,34 +105,36 @@ namespace BansheeEngine
 
 		while(!commands->empty())
 		{
-			QueuedCommand& command = commands->front();
+			execute(commands->front(), notifyCallback);
+			commands->pop();
+		}
 
-			if(command.returnsValue)
-			{
-				AsyncOp& op = *command.asyncOp;
-				command.callbackWithReturnValue(op);
-
-				if(!command.asyncOp->hasCompleted())
-				{
-					LOGDBG("Async operation return value wasn't resolved properly. Resolving automatically to nullptr. " \
-						"Make sure to complete the operation before returning from the command callback method.");
-					command.asyncOp->_completeOperation(nullptr);
-				}
-			}
-			else
-			{
-				command.callback();
-			}
+		mEmptyCommandQueues.push(commands);
+	}
+
+	void CommandQueueBase::execute(QueuedCommand& command, const std::function<void(UINT32)>& notifyCallback)
+	{
+		if(command.returnsValue)
+		{
+			AsyncOp& op = *command.asyncOp;
+			command.callbackWithReturnValue(op);
 
-			if(command.notifyWhenComplete && notifyCallback != nullptr)
+			if(!command.asyncOp->hasCompleted())
 			{
-				notifyCallback(command.callbackId);
+				LOGDBG("Async operation return value wasn't resolved properly. Resolving automatically to nullptr. " \
+					"Make sure to complete the operation before returning from the command callback method.");
+				command.asyncOp->_completeOperation(nullptr);
 			}
-
-			commands->pop();
+		}
+		else
+		{
+			command.callback();
 		}
 
-		mEmptyCommandQueues.push(commands);
+		if(command.notifyWhenComplete && notifyCallback != nullptr)
+		{
+			notifyCallback(command.callbackId);
+		}
 	}
 
 	void CommandQueueBase::playback(BansheeEngine::Queue<QueuedCommand>* commands)
@@ -163,6 +165,132 @@ namespace BansheeEngine
 		BS_EXCEPT(InternalErrorException, message);
 	}
 
+	CommandQueue<CommandQueueLockFree>::CommandQueue(BS_THREAD_ID_TYPE threadId)
+		:CommandQueueBase(threadId), mHead(nullptr)
+	{
+#if BS_DEBUG_MODE
+		mNextDebugIdx = 0;
+#endif
+	}
+
+	CommandQueue<CommandQueueLockFree>::~CommandQueue()
+	{
+		cancelAll();
+	}
+
+	AsyncOp CommandQueue<CommandQueueLockFree>::queueReturn(std::function<void(AsyncOp&)> commandCallback, 
+		bool _notifyWhenComplete, UINT32 _callbackId)
+	{
+#if BS_DEBUG_MODE
+		UINT32 debugIdx = mNextDebugIdx++;
+		breakIfNeeded(mCommandQueueIdx, debugIdx);
+
+		CommandNode* node = bs_new<CommandNode, PoolAlloc>(commandCallback, debugIdx, _notifyWhenComplete, _callbackId);
+#else
+		CommandNode* node = bs_new<CommandNode, PoolAlloc>(commandCallback, _notifyWhenComplete, _callbackId);
+#endif
+
+		// Copy the op before pushing, as the consumer may execute and free the command at any point after
+		AsyncOp asyncOp = *node->command.asyncOp;
+		push(node);
+
+#if BS_FORCE_SINGLETHREADED_RENDERING
+		CommandNode* commands = flush();
+		playback(commands);
+#endif
+
+		return asyncOp;
+	}
+
+	void CommandQueue<CommandQueueLockFree>::queue(std::function<void()> commandCallback, bool _notifyWhenComplete, UINT32 _callbackId)
+	{
+#if BS_DEBUG_MODE
+		UINT32 debugIdx = mNextDebugIdx++;
+		breakIfNeeded(mCommandQueueIdx, debugIdx);
+
+		CommandNode* node = bs_new<CommandNode, PoolAlloc>(commandCallback, debugIdx, _notifyWhenComplete, _callbackId);
+#else
+		CommandNode* node = bs_new<CommandNode, PoolAlloc>(commandCallback, _notifyWhenComplete, _callbackId);
+#endif
+
+		push(node);
+
+#if BS_FORCE_SINGLETHREADED_RENDERING
+		CommandNode* commands = flush();
+		playback(commands);
+#endif
+	}
+
+	CommandQueue<CommandQueueLockFree>::CommandNode* CommandQueue<CommandQueueLockFree>::flush()
+	{
+		return popAll();
+	}
+
+	void CommandQueue<CommandQueueLockFree>::playbackWithNotify(CommandNode* commands, std::function<void(UINT32)> notifyCallback)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		CommandNode* node = commands;
+		while (node != nullptr)
+		{
+			CommandNode* next = node->next;
+
+			execute(node->command, notifyCallback);
+			bs_delete<PoolAlloc>(node);
+
+			node = next;
+		}
+	}
+
+	void CommandQueue<CommandQueueLockFree>::playback(CommandNode* commands)
+	{
+		playbackWithNotify(commands, std::function<void(UINT32)>());
+	}
+
+	void CommandQueue<CommandQueueLockFree>::cancelAll()
+	{
+		CommandNode* node = popAll();
+		while (node != nullptr)
+		{
+			CommandNode* next = node->next;
+			bs_delete<PoolAlloc>(node);
+
+			node = next;
+		}
+	}
+
+	bool CommandQueue<CommandQueueLockFree>::isEmpty()
+	{
+		return mHead.load() == nullptr;
+	}
+
+	void CommandQueue<CommandQueueLockFree>::push(CommandNode* node)
+	{
+		CommandNode* head = mHead.load(std::memory_order_relaxed);
+		do
+		{
+			node->next = head;
+		} while (!mHead.compare_exchange_weak(head, node));
+	}
+
+	CommandQueue<CommandQueueLockFree>::CommandNode* CommandQueue<CommandQueueLockFree>::popAll()
+	{
+		CommandNode* node = mHead.exchange(nullptr);
+
+		// Nodes are in reverse order of queuing, restore the proper order
+		CommandNode* ordered = nullptr;
+		while (node != nullptr)
+		{
+			CommandNode* next = node->next;
+			node->next = ordered;
+			ordered = node;
+
+			node = next;
+		}
+
+		return ordered;
+	}
+
 #if BS_DEBUG_MODE
 	BS_STATIC_MUTEX_CLASS_INSTANCE(CommandQueueBreakpointMutex, CommandQueueBase);
 
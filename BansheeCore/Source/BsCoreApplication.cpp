@@ -39,7 +39,7 @@
 #include "BsQueryManager.h"
 #include "BsThreadPool.h"
 #include "BsTaskScheduler.h"
-#include "BsUUID.h"
+#include "BsUUIDGenerator.h"
 #include "BsRenderStats.h"
 
 #include "BsMaterial.h"
@@ -63,7 +63,11 @@ namespace BansheeEngine
 		UUIDGenerator::startUp();
 		ProfilerCPU::startUp();
 		ProfilingManager::startUp();
-		ThreadPool::startUp<TThreadPool<ThreadBansheePolicy>>((numWorkerThreads));
+		// Task scheduler workers keep their threads for as long as the scheduler is running, so make sure the pool
+		// can provide all of them, in addition to the core thread and any other users
+		UINT32 maxNumThreads = std::max(16U, TaskScheduler::getMaxNumWorkers() + 2);
+
+		ThreadPool::startUp<TThreadPool<ThreadBansheePolicy>>(numWorkerThreads, maxNumThreads);
 		TaskScheduler::startUp();
 		TaskScheduler::instance().removeWorker();
 		RenderStats::startUp();
@@ -161,6 +165,7 @@ namespace BansheeEngine
 			RenderWindowManager::instance()._update();
 			gInput()._update();
 			gTime().update();
+			gResources()._update();
 
 			PROFILE_CALL(gSceneManager()._update(), "SceneManager");
 
@@ -4,7 +4,7 @@
 #include "BsCoreThread.h"
 #include "BsThreadPool.h"
 #include "BsTaskScheduler.h"
-#include "BsFrameAlloc.h"
+#include "BsFrameAllocRegistry.h"
 
 using namespace std::placeholders;
 
@@ -14,16 +14,15 @@ namespace BansheeEngine
 
 	CoreThread::CoreThread()
 		: mCoreThreadShutdown(false)
+		, mCoreThreadSleeping(false)
 		, mCommandQueue(nullptr)
 		, mMaxCommandNotifyId(0)
 		, mSyncedCoreAccessor(nullptr)
-		, mActiveFrameAlloc(0)
 	{
-		mFrameAllocs[0] = bs_new<FrameAlloc>();
-		mFrameAllocs[1] = bs_new<FrameAlloc>();
+		mFrameAllocs = bs_new<FrameAllocRegistry>();
 
 		mCoreThreadId = BS_THREAD_CURRENT_ID;
-		mCommandQueue = bs_new<CommandQueue<CommandQueueSync>>(BS_THREAD_CURRENT_ID);
+		mCommandQueue = bs_new<CommandQueue<CommandQueueLockFree>>(BS_THREAD_CURRENT_ID);
 
 		initCoreThread();
 	}
@@ -50,8 +49,7 @@ namespace BansheeEngine
 			mCommandQueue = nullptr;
 		}
 
-		bs_delete(mFrameAllocs[0]);
-		bs_delete(mFrameAllocs[1]);
+		bs_delete(mFrameAllocs);
 	}
 
 	void CoreThread::initCoreThread()
@@ -76,14 +74,18 @@ namespace BansheeEngine
 		while(true)
 		{
 			// Wait until we get some ready commands
-			Queue<QueuedCommand>* commands = nullptr;
+			if(mCommandQueue->isEmpty())
 			{
 				BS_LOCK_MUTEX_NAMED(mCommandQueueMutex, lock)
 
+				// Producers check the flag after queuing, so they either see it or we see their command
+				mCoreThreadSleeping = true;
 				while(mCommandQueue->isEmpty())
 				{
 					if(mCoreThreadShutdown)
 					{
+						mCoreThreadSleeping = false;
+
 						bs_delete(mSyncedCoreAccessor);
 						TaskScheduler::instance().addWorker();
 						return;
@@ -93,11 +95,11 @@ namespace BansheeEngine
 					BS_THREAD_WAIT(mCommandReadyCondition, mCommandQueueMutex, lock);
 					TaskScheduler::instance().removeWorker();
 				}
-
-				commands = mCommandQueue->flush();
+				mCoreThreadSleeping = false;
 			}
 
-			// Play commands
+			// Take all queued commands at once and play them
+			CommandQueue<CommandQueueLockFree>::CommandNode* commands = mCommandQueue->flush();
 			mCommandQueue->playbackWithNotify(commands, std::bind(&CoreThread::commandCompletedNotify, this, _1)); 
 		}
 #endif
@@ -168,19 +170,15 @@ namespace BansheeEngine
 		}
 
 		UINT32 commandId = -1;
+		if(blockUntilComplete)
 		{
-			BS_LOCK_MUTEX(mCommandQueueMutex);
-
-			if(blockUntilComplete)
-			{
-				commandId = mMaxCommandNotifyId++;
-				op = mCommandQueue->queueReturn(commandCallback, true, commandId);
-			}
-			else
-				op = mCommandQueue->queueReturn(commandCallback);
+			commandId = mMaxCommandNotifyId++;
+			op = mCommandQueue->queueReturn(commandCallback, true, commandId);
 		}
+		else
+			op = mCommandQueue->queueReturn(commandCallback);
 
-		BS_THREAD_NOTIFY_ALL(mCommandReadyCondition);
+		notifyCommandReady();
 
 		if(blockUntilComplete)
 			blockUntilCommandCompleted(commandId);
@@ -197,33 +195,37 @@ namespace BansheeEngine
 		}
 
 		UINT32 commandId = -1;
+		if(blockUntilComplete)
 		{
-			BS_LOCK_MUTEX(mCommandQueueMutex);
-
-			if(blockUntilComplete)
-			{
-				commandId = mMaxCommandNotifyId++;
-				mCommandQueue->queue(commandCallback, true, commandId);
-			}
-			else
-				mCommandQueue->queue(commandCallback);
+			commandId = mMaxCommandNotifyId++;
+			mCommandQueue->queue(commandCallback, true, commandId);
 		}
+		else
+			mCommandQueue->queue(commandCallback);
 
-		BS_THREAD_NOTIFY_ALL(mCommandReadyCondition);
+		notifyCommandReady();
 
 		if(blockUntilComplete)
 			blockUntilCommandCompleted(commandId);
 	}
 
+	void CoreThread::notifyCommandReady()
+	{
+		if(mCoreThreadSleeping.load())
+		{
+			BS_LOCK_MUTEX(mCommandQueueMutex);
+			BS_THREAD_NOTIFY_ALL(mCommandReadyCondition);
+		}
+	}
+
 	void CoreThread::update()
 	{
-		mActiveFrameAlloc = (mActiveFrameAlloc + 1) % 2;
-		mFrameAllocs[mActiveFrameAlloc]->clear();
+		mFrameAllocs->advanceFrame();
 	}
 
 	FrameAlloc* CoreThread::getFrameAlloc() const
 	{
-		return mFrameAllocs[mActiveFrameAlloc];
+		return mFrameAllocs->getFrameAlloc();
 	}
 
 	void CoreThread::blockUntilCommandCompleted(UINT32 commandId)
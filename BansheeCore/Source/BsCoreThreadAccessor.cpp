@@ -17,134 +17,135 @@
 namespace BansheeEngine
 {
 	CoreThreadAccessorBase::CoreThreadAccessorBase(CommandQueueBase* commandQueue)
-		:mCommandQueue(commandQueue)
+		:mCommandQueue(commandQueue), mActiveFrameCommands(nullptr)
 	{
 
 	}
 
 	CoreThreadAccessorBase::~CoreThreadAccessorBase()
 	{
+		destroyPendingFrameCommandBuffers();
 		bs_delete(mCommandQueue);
 	}
 
 	void CoreThreadAccessorBase::disableTextureUnit(GpuProgramType gptype, UINT16 texUnit)
 	{
-		mCommandQueue->queue(std::bind(&RenderSystem::disableTextureUnit, RenderSystem::instancePtr(), gptype, texUnit));
+		queueCommand(std::bind(&RenderSystem::disableTextureUnit, RenderSystem::instancePtr(), gptype, texUnit));
 	}
 
 	void CoreThreadAccessorBase::setTexture(GpuProgramType gptype, UINT16 unit, bool enabled, const TexturePtr &texPtr)
 	{
-		mCommandQueue->queue(std::bind(&RenderSystem::setTexture, RenderSystem::instancePtr(), gptype, unit, enabled, texPtr));
+		queueCommand(std::bind(&RenderSystem::setTexture, RenderSystem::instancePtr(), gptype, unit, enabled, texPtr));
 	}
 
 	void CoreThreadAccessorBase::setSamplerState(GpuProgramType gptype, UINT16 texUnit, const SamplerStatePtr& samplerState)
 	{
-		mCommandQueue->queue(std::bind(&RenderSystem::setSamplerState, RenderSystem::instancePtr(), gptype, texUnit, samplerState));
+		queueCommand(std::bind(&RenderSystem::setSamplerState, RenderSystem::instancePtr(), gptype, texUnit, samplerState));
 	}
 
 	void CoreThreadAccessorBase::setBlendState(const BlendStatePtr& blendState)
 	{
-		mCommandQueue->queue(std::bind(&RenderSystem::setBlendState, RenderSystem::instancePtr(), blendState));
+		queueCommand(std::bind(&RenderSystem::setBlendState, RenderSystem::instancePtr(), blendState));
 	}
 
 	void CoreThreadAccessorBase::setRasterizerState(const RasterizerStatePtr& rasterizerState)
 	{
-		mCommandQueue->queue(std::bind(&RenderSystem::setRasterizerState, RenderSystem::instancePtr(), rasterizerState));
+		queueCommand(std::bind(&RenderSystem::setRasterizerState, RenderSystem::instancePtr(), rasterizerState));
 	}
 
 	void CoreThreadAccessorBase::setDepthStencilState(const DepthStencilStatePtr& depthStencilState, UINT32 stencilRefValue)
 	{
-		mCommandQueue->queue(std::bind(&RenderSystem::setDepthStencilState, RenderSystem::instancePtr(), depthStencilState, stencilRefValue));
+		queueCommand(std::bind(&RenderSystem::setDepthStencilState, RenderSystem::instancePtr(), depthStencilState, stencilRefValue));
 	}
 
 	void CoreThreadAccessorBase::setViewport(Viewport vp)
 	{
-		mCommandQueue->queue(std::bind(&RenderSystem::setViewport, RenderSystem::instancePtr(), vp));
+		queueCommand(std::bind(&RenderSystem::setViewport, RenderSystem::instancePtr(), vp));
 	}
 
 	void CoreThreadAccessorBase::setDrawOperation(DrawOperationType op)
 	{
-		mCommandQueue->queue(std::bind(&RenderSystem::setDrawOperation, RenderSystem::instancePtr(), op));
+		queueCommand(std::bind(&RenderSystem::setDrawOperation, RenderSystem::instancePtr(), op));
 	}
 
 	void CoreThreadAccessorBase::setClipPlanes(const PlaneList& clipPlanes)
 	{
-		mCommandQueue->queue(std::bind(&RenderSystem::setClipPlanes, RenderSystem::instancePtr(), clipPlanes));
+		queueCommand(std::bind(&RenderSystem::setClipPlanes, RenderSystem::instancePtr(), clipPlanes));
 	}
 
 	void CoreThreadAccessorBase::addClipPlane(const Plane& p)
 	{
-		mCommandQueue->queue(std::bind(&RenderSystem::addClipPlane, RenderSystem::instancePtr(), p));
+		queueCommand(std::bind(&RenderSystem::addClipPlane, RenderSystem::instancePtr(), p));
 	}
 
 	void CoreThreadAccessorBase::resetClipPlanes()
 	{
-		mCommandQueue->queue(std::bind(&RenderSystem::resetClipPlanes, RenderSystem::instancePtr()));
+		queueCommand(std::bind(&RenderSystem::resetClipPlanes, RenderSystem::instancePtr()));
 	}
 
 	void CoreThreadAccessorBase::setScissorTest(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom)
 	{
-		mCommandQueue->queue(std::bind(&RenderSystem::setScissorRect, RenderSystem::instancePtr(), left, top, right, bottom));
+		queueCommand(std::bind(&RenderSystem::setScissorRect, RenderSystem::instancePtr(), left, top, right, bottom));
 	}
 
 	void CoreThreadAccessorBase::setRenderTarget(RenderTargetPtr target)
 	{
-		mCommandQueue->queue(std::bind(&RenderSystem::setRenderTarget, RenderSystem::instancePtr(), target));
+		queueCommand(std::bind(&RenderSystem::setRenderTarget, RenderSystem::instancePtr(), target));
 	}
 
 	void CoreThreadAccessorBase::bindGpuProgram(HGpuProgram prg)
 	{
-		mCommandQueue->queue(std::bind(&RenderSystem::bindGpuProgram, RenderSystem::instancePtr(), prg));
+		queueCommand(std::bind(&RenderSystem::bindGpuProgram, RenderSystem::instancePtr(), prg));
 	}
 
 	void CoreThreadAccessorBase::unbindGpuProgram(GpuProgramType gptype)
 	{
-		mCommandQueue->queue(std::bind(&RenderSystem::unbindGpuProgram, RenderSystem::instancePtr(), gptype));
+		queueCommand(std::bind(&RenderSystem::unbindGpuProgram, RenderSystem::instancePtr(), gptype));
 	}
 
 	void CoreThreadAccessorBase::bindGpuParams(GpuProgramType gptype, const GpuParamsPtr& params)
 	{
-		mCommandQueue->queue(std::bind(&RenderSystem::bindGpuParams, RenderSystem::instancePtr(), gptype, params->_cloneForCore(gCoreThread().getFrameAlloc())));
+		queueCommand(std::bind(&RenderSystem::bindGpuParams, RenderSystem::instancePtr(), gptype, params->_cloneForCore(gCoreThread().getFrameAlloc())));
 	}
 
 	void CoreThreadAccessorBase::beginRender()
 	{
-		mCommandQueue->queue(std::bind(&RenderSystem::beginFrame, RenderSystem::instancePtr()));
+		queueCommand(std::bind(&RenderSystem::beginFrame, RenderSystem::instancePtr()));
 	}
 
 	void CoreThreadAccessorBase::endRender()
 	{
-		mCommandQueue->queue(std::bind(&RenderSystem::endFrame, RenderSystem::instancePtr()));
+		queueCommand(std::bind(&RenderSystem::endFrame, RenderSystem::instancePtr()));
 	}
 
 	void CoreThreadAccessorBase::clearRenderTarget(UINT32 buffers, const Color& color, float depth, UINT16 stencil)
 	{
-		mCommandQueue->queue(std::bind(&RenderSystem::clearRenderTarget, RenderSystem::instancePtr(), buffers, color, depth, stencil));
+		queueCommand(std::bind(&RenderSystem::clearRenderTarget, RenderSystem::instancePtr(), buffers, color, depth, stencil));
 	}
 
 	void CoreThreadAccessorBase::clearViewport(UINT32 buffers, const Color& color, float depth, UINT16 stencil)
 	{
-		mCommandQueue->queue(std::bind(&RenderSystem::clearViewport, RenderSystem::instancePtr(), buffers, color, depth, stencil));
+		queueCommand(std::bind(&RenderSystem::clearViewport, RenderSystem::instancePtr(), buffers, color, depth, stencil));
 	}
 
 	void CoreThreadAccessorBase::swapBuffers(RenderTargetPtr target)
 	{
-		mCommandQueue->queue(std::bind(&RenderSystem::swapBuffers, RenderSystem::instancePtr(), target));
+		queueCommand(std::bind(&RenderSystem::swapBuffers, RenderSystem::instancePtr(), target));
 	}
 
 	void CoreThreadAccessorBase::render(const MeshBasePtr& mesh, UINT32 indexOffset, UINT32 indexCount, bool useIndices, DrawOperationType drawOp)
 	{
-		mCommandQueue->queue(std::bind(&RenderSystem::render, RenderSystem::instancePtr(), mesh, indexOffset, indexCount, useIndices, drawOp));
+		queueCommand(std::bind(&RenderSystem::render, RenderSystem::instancePtr(), mesh, indexOffset, indexCount, useIndices, drawOp));
 	}
 
 	void CoreThreadAccessorBase::draw(UINT32 vertexOffset, UINT32 vertexCount)
 	{
-		mCommandQueue->queue(std::bind(&RenderSystem::draw, RenderSystem::instancePtr(), vertexOffset, vertexCount));
+		queueCommand(std::bind(&RenderSystem::draw, RenderSystem::instancePtr(), vertexOffset, vertexCount));
 	}
 
 	void CoreThreadAccessorBase::drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount)
 	{
-		mCommandQueue->queue(std::bind(&RenderSystem::drawIndexed, RenderSystem::instancePtr(), startIndex, indexCount, vertexOffset, vertexCount));
+		queueCommand(std::bind(&RenderSystem::drawIndexed, RenderSystem::instancePtr(), startIndex, indexCount, vertexOffset, vertexCount));
 	}
 
 	AsyncOp CoreThreadAccessorBase::writeSubresource(GpuResourcePtr resource, UINT32 subresourceIdx, const GpuResourceDataPtr& data, bool discardEntireBuffer)
@@ -152,7 +153,7 @@ namespace BansheeEngine
 		data->_lock();
 
 		resource->_writeSubresourceSim(subresourceIdx, *data, discardEntireBuffer);
-		return mCommandQueue->queueReturn(std::bind(&RenderSystem::writeSubresource, RenderSystem::instancePtr(), resource, 
+		return queueReturnCommand(std::bind(&RenderSystem::writeSubresource, RenderSystem::instancePtr(), resource, 
 			subresourceIdx, data, discardEntireBuffer, std::placeholders::_1));
 	}
 
@@ -160,28 +161,28 @@ namespace BansheeEngine
 	{
 		data->_lock();
 
-		return mCommandQueue->queueReturn(std::bind(&RenderSystem::readSubresource, RenderSystem::instancePtr(), 
+		return queueReturnCommand(std::bind(&RenderSystem::readSubresource, RenderSystem::instancePtr(), 
 			resource, subresourceIdx, data, std::placeholders::_1));
 	}
 
 	void CoreThreadAccessorBase::resizeWindow(RenderWindowPtr& renderWindow, UINT32 width, UINT32 height)
 	{
-		mCommandQueue->queue(std::bind(&RenderWindow::resize, renderWindow.get(), width, height));
+		queueCommand(std::bind(&RenderWindow::resize, renderWindow.get(), width, height));
 	}
 
 	void CoreThreadAccessorBase::moveWindow(RenderWindowPtr& renderWindow, INT32 left, INT32 top)
 	{
-		mCommandQueue->queue(std::bind(&RenderWindow::move, renderWindow.get(), left, top));
+		queueCommand(std::bind(&RenderWindow::move, renderWindow.get(), left, top));
 	}
 
 	void CoreThreadAccessorBase::hideWindow(RenderWindowPtr& renderWindow)
 	{
-		mCommandQueue->queue(std::bind(&RenderWindow::setHidden, renderWindow.get(), true));
+		queueCommand(std::bind(&RenderWindow::setHidden, renderWindow.get(), true));
 	}
 
 	void CoreThreadAccessorBase::showWindow(RenderWindowPtr& renderWindow)
 	{
-		mCommandQueue->queue(std::bind(&RenderWindow::setHidden, renderWindow.get(), false));
+		queueCommand(std::bind(&RenderWindow::setHidden, renderWindow.get(), false));
 	}
 
 	void CoreThreadAccessorBase::setFullscreen(RenderWindowPtr& renderWindow, UINT32 width, UINT32 height, 
@@ -189,33 +190,41 @@ namespace BansheeEngine
 	{
 		void(RenderWindow::*funcPtr)(UINT32, UINT32, float, UINT32) = &RenderWindow::setFullscreen;
 
-		mCommandQueue->queue(std::bind(funcPtr, renderWindow.get(), width, height, refreshRate, monitorIdx));
+		queueCommand(std::bind(funcPtr, renderWindow.get(), width, height, refreshRate, monitorIdx));
 	}
 
 	void CoreThreadAccessorBase::setFullscreen(RenderWindowPtr& renderWindow, const VideoMode& mode)
 	{
 		void(RenderWindow::*funcPtr)(const VideoMode&) = &RenderWindow::setFullscreen;
 
-		mCommandQueue->queue(std::bind(funcPtr, renderWindow.get(), std::cref(mode)));
+		queueCommand(std::bind(funcPtr, renderWindow.get(), std::cref(mode)));
 	}
 
 	void CoreThreadAccessorBase::setWindowed(RenderWindowPtr& renderWindow, UINT32 width, UINT32 height)
 	{
-		mCommandQueue->queue(std::bind(&RenderWindow::setWindowed, renderWindow.get(), width, height));
+		queueCommand(std::bind(&RenderWindow::setWindowed, renderWindow.get(), width, height));
 	}
 
 	AsyncOp CoreThreadAccessorBase::queueReturnCommand(std::function<void(AsyncOp&)> commandCallback)
 	{
+		endFrameCommandBuffer();
+
 		return mCommandQueue->queueReturn(commandCallback);
 	}
 
 	void CoreThreadAccessorBase::queueCommand(std::function<void()> commandCallback)
 	{
+		endFrameCommandBuffer();
+
 		mCommandQueue->queue(commandCallback);
 	}
 
 	void CoreThreadAccessorBase::submitToCoreThread(bool blockUntilComplete)
 	{
+		// Core thread takes ownership of all frame command buffers queued so far
+		endFrameCommandBuffer();
+		mPendingFrameCommands.clear();
+
 		Queue<QueuedCommand>* commands = mCommandQueue->flush();
 
 		gCoreThread().queueCommand(std::bind(&CommandQueueBase::playback, mCommandQueue, commands), blockUntilComplete);
@@ -225,6 +234,35 @@ namespace BansheeEngine
 	{
 		// Note that this won't free any Frame data allocated for all the canceled commands since
 		// frame data will only get cleared at frame start
+		destroyPendingFrameCommandBuffers();
 		mCommandQueue->cancelAll();
 	}
+
+	FrameCommandBuffer* CoreThreadAccessorBase::getFrameCommandBuffer()
+	{
+		if(mActiveFrameCommands == nullptr)
+		{
+			mActiveFrameCommands = FrameCommandBuffer::create(gCoreThread().getFrameAlloc());
+			mPendingFrameCommands.push_back(mActiveFrameCommands);
+
+			mCommandQueue->queue(std::bind(&FrameCommandBuffer::executeAndDestroy, mActiveFrameCommands));
+		}
+
+		return mActiveFrameCommands;
+	}
+
+	void CoreThreadAccessorBase::endFrameCommandBuffer()
+	{
+		mActiveFrameCommands = nullptr;
+	}
+
+	void CoreThreadAccessorBase::destroyPendingFrameCommandBuffers()
+	{
+		endFrameCommandBuffer();
+
+		for(auto& buffer : mPendingFrameCommands)
+			FrameCommandBuffer::destroy(buffer);
+
+		mPendingFrameCommands.clear();
+	}
 }
\ No newline at end of file
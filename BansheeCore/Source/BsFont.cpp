@@ -54,6 +54,15 @@ namespace BansheeEngine
 		return &iterFind->second;
 	}
 
+	UINT32 Font::calculateSize() const
+	{
+		UINT32 size = 0;
+		for(auto& fontData : mFontDataPerSize)
+			size += RTTIPlainType<FONT_DESC>::getDynamicSize(fontData.second.fontDesc);
+
+		return size;
+	}
+
 	INT32 Font::getClosestAvailableSize(UINT32 size) const
 	{
 		UINT32 minDiff = std::numeric_limits<UINT32>::max();
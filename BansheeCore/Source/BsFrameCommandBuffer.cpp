@@ -0,0 +1,72 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsFrameCommandBuffer.h"
+
+namespace BansheeEngine
+{
+	FrameCommandBuffer::FrameCommandBuffer(FrameAlloc* alloc)
+		:mAlloc(alloc), mFirst(nullptr), mLast(nullptr)
+	{ }
+
+	FrameCommandBuffer::~FrameCommandBuffer()
+	{
+		clear();
+	}
+
+	FrameCommandBuffer* FrameCommandBuffer::create(FrameAlloc* alloc)
+	{
+		UINT8* data = alloc->alloc(sizeof(FrameCommandBuffer), (UINT32)std::alignment_of<FrameCommandBuffer>::value);
+
+		return new (data) FrameCommandBuffer(alloc);
+	}
+
+	void FrameCommandBuffer::destroy(FrameCommandBuffer* buffer)
+	{
+		FrameAlloc* alloc = buffer->mAlloc;
+
+		buffer->~FrameCommandBuffer();
+		alloc->dealloc((UINT8*)buffer);
+	}
+
+	void FrameCommandBuffer::executeAndDestroy(FrameCommandBuffer* buffer)
+	{
+		buffer->execute();
+		destroy(buffer);
+	}
+
+	void FrameCommandBuffer::execute()
+	{
+		CommandHeader* command = mFirst;
+		mFirst = nullptr;
+		mLast = nullptr;
+
+		while(command != nullptr)
+		{
+			CommandHeader* next = command->next;
+
+			command->execute(command);
+			command->destroy(command);
+			mAlloc->dealloc((UINT8*)command);
+
+			command = next;
+		}
+	}
+
+	void FrameCommandBuffer::clear()
+	{
+		CommandHeader* command = mFirst;
+		mFirst = nullptr;
+		mLast = nullptr;
+
+		while(command != nullptr)
+		{
+			CommandHeader* next = command->next;
+
+			command->destroy(command);
+			mAlloc->dealloc((UINT8*)command);
+
+			command = next;
+		}
+	}
+}
@@ -44,7 +44,7 @@ namespace BansheeEngine
 	void GenericGpuParamBlockBuffer::initialize_internal()
 	{
 		if (mSize > 0)
-			mData = (UINT8*)bs_alloc<ScratchAlloc>(mSize);
+			mData = (UINT8*)bs_alloc<GenAlloc>(mSize);
 		else
 			mData = nullptr;
 
@@ -56,7 +56,7 @@ namespace BansheeEngine
 	void GenericGpuParamBlockBuffer::destroy_internal()
 	{
 		if(mData != nullptr)
-			bs_free<ScratchAlloc>(mData);
+			bs_free<GenAlloc>(mData);
 
 		GpuParamBlockBuffer::destroy_internal();
 	}
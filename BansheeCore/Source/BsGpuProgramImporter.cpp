@@ -7,6 +7,7 @@
 #include "BsFileSystem.h"
 #include "BsGpuProgramImportOptions.h"
 #include "BsGpuProgram.h"
+#include "BsGpuProgInclude.h"
 #include "BsDebug.h"
 
 namespace BansheeEngine
@@ -60,4 +61,15 @@ namespace BansheeEngine
 	{
 		return bs_shared_ptr<GpuProgramImportOptions, PoolAlloc>();
 	}
+
+	void GpuProgramImporter::getExternalInputs(const ConstImportOptionsPtr& importOptions, Vector<String>& contents) const
+	{
+		// Includes are prepended to the program source, so their contents affect the imported program
+		const GpuProgramImportOptions* gpuProgImportOptions = static_cast<const GpuProgramImportOptions*>(importOptions.get());
+		for(auto& include : gpuProgImportOptions->getIncludes())
+		{
+			if(include != nullptr)
+				contents.push_back(include->getString());
+		}
+	}
 }
\ No newline at end of file
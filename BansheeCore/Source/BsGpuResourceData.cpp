@@ -17,6 +17,7 @@ namespace BansheeEngine
 	GpuResourceData::GpuResourceData(const GpuResourceData& copy)
 	{
 		mData = copy.mData;
+		mDataOwner = copy.mDataOwner;
 		mLocked = copy.mLocked; // TODO - This should be shared by all copies pointing to the same data?
 		mOwnsData = false;
 	}
@@ -29,6 +30,7 @@ namespace BansheeEngine
 	GpuResourceData& GpuResourceData::operator=(const GpuResourceData& rhs)
 	{
 		mData = rhs.mData;
+		mDataOwner = rhs.mDataOwner;
 		mLocked = rhs.mLocked; // TODO - This should be shared by all copies pointing to the same data?
 		mOwnsData = false;
 
@@ -65,7 +67,8 @@ namespace BansheeEngine
 
 		freeInternalBuffer();
 
-		mData = (UINT8*)bs_alloc<ScratchAlloc>(size);
+		mData = (UINT8*)bs_alloc<GenAlloc>(size);
+		mDataOwner = nullptr;
 		mOwnsData = true;
 	}
 
@@ -82,11 +85,11 @@ namespace BansheeEngine
 		}
 #endif
 
-		bs_free<ScratchAlloc>(mData);
+		bs_free<GenAlloc>(mData);
 		mData = nullptr;
 	}
 
-	void GpuResourceData::setExternalBuffer(UINT8* data)
+	void GpuResourceData::setExternalBuffer(UINT8* data, const std::shared_ptr<void>& dataOwner)
 	{
 #if !BS_FORCE_SINGLETHREADED_RENDERING
 		if(mLocked)
@@ -99,6 +102,7 @@ namespace BansheeEngine
 		freeInternalBuffer();
 
 		mData = data;
+		mDataOwner = dataOwner;
 		mOwnsData = false;
 	}
 
@@ -14,9 +14,32 @@
 #include "BsException.h"
 #include "BsUUID.h"
 #include "BsResources.h"
+#include "BsResourceManifest.h"
+#include "BsSavedResourceData.h"
+#include "BsFileSerializer.h"
+#include "BsMemorySerializer.h"
 
 namespace BansheeEngine
 {
+	const WString Importer::IMPORT_CACHE_MANIFEST_NAME = L"ImportCache.manifest";
+	const WString Importer::IMPORT_CACHE_EXTENSION = L".asset";
+	const UINT32 Importer::IMPORT_CACHE_VERSION = 1;
+
+	/**
+	 * @brief	Incrementally calculates a 64-bit FNV-1a hash of the provided data.
+	 */
+	static UINT64 hashFNV1a(UINT64 hash, const void* data, size_t size)
+	{
+		const UINT8* bytes = (const UINT8*)data;
+		for(size_t i = 0; i < size; i++)
+		{
+			hash ^= bytes[i];
+			hash *= 0x100000001B3ULL;
+		}
+
+		return hash;
+	}
+
 	Importer::Importer()
 	{
 		_registerAssetImporter(bs_new<GpuProgIncludeImporter>());
@@ -80,8 +103,23 @@ namespace BansheeEngine
 			}
 		}
 
+		String cacheKey;
+		if(!mImportCacheFolder.isEmpty())
+		{
+			cacheKey = getImportCacheKey(importer, inputFilePath, importOptions);
+
+			HResource cachedResource = loadFromImportCache(cacheKey);
+			if(cachedResource)
+				return cachedResource;
+		}
+
 		ResourcePtr importedResource = importer->import(inputFilePath, importOptions);
-		return gResources()._createResourceHandle(importedResource);
+		HResource importedHandle = gResources()._createResourceHandle(importedResource);
+
+		if(!cacheKey.empty() && importedResource != nullptr)
+			saveToImportCache(cacheKey, importedHandle);
+
+		return importedHandle;
 	}
 
 	void Importer::reimport(HResource& existingResource, const Path& inputFilePath, ConstImportOptionsPtr importOptions)
@@ -127,6 +165,171 @@ namespace BansheeEngine
 		return importer->createImportOptions();
 	}
 
+	void Importer::setImportCacheFolder(const Path& folder)
+	{
+		mImportCacheManifest = nullptr;
+
+		if(folder.isEmpty())
+		{
+			mImportCacheFolder = Path::BLANK;
+			return;
+		}
+
+		// Manifest stores paths relative to the cache folder, so it must be absolute
+		mImportCacheFolder = folder.getAbsolute(FileSystem::getWorkingDirectoryPath());
+
+		if(!FileSystem::isDirectory(mImportCacheFolder))
+			FileSystem::createDir(mImportCacheFolder);
+
+		Path manifestPath = mImportCacheFolder;
+		manifestPath.append(IMPORT_CACHE_MANIFEST_NAME);
+
+		if(FileSystem::isFile(manifestPath))
+			mImportCacheManifest = ResourceManifest::load(manifestPath, mImportCacheFolder);
+		else
+			mImportCacheManifest = ResourceManifest::create("ImportCache");
+
+		gResources().registerResourceManifest(mImportCacheManifest);
+	}
+
+	String Importer::getImportCacheKey(SpecificImporter* importer, const Path& inputFilePath, 
+		const ConstImportOptionsPtr& importOptions) const
+	{
+		// Keys start with a hash of the source path, so entries of previous imports of the same file can be found
+		String sourcePath = inputFilePath.getAbsolute(FileSystem::getWorkingDirectoryPath()).toString();
+		UINT64 sourceHash = hashFNV1a(0xCBF29CE484222325ULL, sourcePath.data(), sourcePath.size());
+
+		UINT64 hash = 0xCBF29CE484222325ULL;
+		hash = hashFNV1a(hash, &IMPORT_CACHE_VERSION, sizeof(IMPORT_CACHE_VERSION));
+
+		// Different importers may support the same extension, but they never share import option types
+		UINT32 optionsTypeId = importOptions->getTypeId();
+		hash = hashFNV1a(hash, &optionsTypeId, sizeof(optionsTypeId));
+
+		UINT32 optionsSize = 0;
+		MemorySerializer ms;
+		UINT8* optionsData = ms.encode(const_cast<ImportOptions*>(importOptions.get()), optionsSize);
+		hash = hashFNV1a(hash, optionsData, optionsSize);
+		bs_free(optionsData);
+
+		// Options only reference other resources by UUID, so contents of any external inputs are hashed separately
+		Vector<String> externalInputs;
+		importer->getExternalInputs(importOptions, externalInputs);
+
+		for(auto& input : externalInputs)
+		{
+			UINT64 inputSize = input.size();
+			hash = hashFNV1a(hash, &inputSize, sizeof(inputSize));
+			hash = hashFNV1a(hash, input.data(), input.size());
+		}
+
+		DataStreamPtr stream = FileSystem::openFile(inputFilePath);
+
+		static const UINT32 READ_BUFFER_SIZE = 64 * 1024;
+		UINT8* readBuffer = (UINT8*)bs_alloc(READ_BUFFER_SIZE);
+
+		size_t bytesRead = 0;
+		while((bytesRead = stream->read(readBuffer, READ_BUFFER_SIZE)) > 0)
+			hash = hashFNV1a(hash, readBuffer, bytesRead);
+
+		bs_free(readBuffer);
+		stream->close();
+
+		StringStream keyStream;
+		keyStream << std::hex << std::setfill('0') << std::setw(16) << sourceHash << "-" << std::setw(16) << hash;
+
+		return keyStream.str();
+	}
+
+	HResource Importer::loadFromImportCache(const String& key)
+	{
+		Path cachedPath = mImportCacheFolder;
+		cachedPath.append(toWString(key) + IMPORT_CACHE_EXTENSION);
+
+		if(!mImportCacheManifest->filePathExists(cachedPath) || !FileSystem::isFile(cachedPath))
+			return HResource();
+
+		// Resource is decoded directly instead of loaded through Resources, so every import returns its own copy
+		FileSerializer fs;
+		std::shared_ptr<IReflectable> loadedData = fs.decode(cachedPath);
+		if(loadedData == nullptr || !loadedData->isDerivedFrom(Resource::getRTTIStatic()))
+			return HResource();
+
+		return gResources()._createResourceHandle(std::static_pointer_cast<Resource>(loadedData));
+	}
+
+	void Importer::saveToImportCache(const String& key, const HResource& resource)
+	{
+		// Source file was changed, or imported with different options, since it was last cached
+		String sourcePrefix = key.substr(0, key.find('-') + 1);
+		removeFromImportCache(sourcePrefix);
+
+		Path cachedPath = mImportCacheFolder;
+		cachedPath.append(toWString(key) + IMPORT_CACHE_EXTENSION);
+
+		Vector<std::pair<HResource, Path>> resourcesToSave;
+		resourcesToSave.push_back(std::make_pair(resource, cachedPath));
+
+		// Referenced resources that only exist in memory (e.g. created by the importer) are saved as well, 
+		// otherwise references to them couldn't be resolved when the cached resource is loaded
+		while(!resourcesToSave.empty())
+		{
+			std::pair<HResource, Path> entry = resourcesToSave.back();
+			resourcesToSave.pop_back();
+
+			if(FileSystem::isFile(entry.second))
+				FileSystem::remove(entry.second);
+
+			// Saved directly instead of through Resources, so the resource is only registered in the cache manifest
+			SavedResourceData resourceData;
+			ResourceSaveContext saveContext(resourceData);
+
+			// Imported resource types support being encoded from multiple threads, so encode them in parallel
+			FileSerializer fs;
+			fs.encode(entry.first.get(), entry.second, false, &resourceData, true, &saveContext);
+			mImportCacheManifest->registerResource(entry.first.getUUID(), entry.second);
+
+			for(auto& dependency : resourceData.getDependencies())
+			{
+				Path dependencyPath;
+				if(gResources().getFilePathFromUUID(dependency, dependencyPath))
+					continue;
+
+				HResource dependencyHandle = gResources().getLoadedResource(dependency);
+				if(!dependencyHandle)
+					continue;
+
+				dependencyPath = mImportCacheFolder;
+				dependencyPath.append(toWString(sourcePrefix + dependency.toString()) + IMPORT_CACHE_EXTENSION);
+
+				resourcesToSave.push_back(std::make_pair(dependencyHandle, dependencyPath));
+			}
+		}
+
+		Path manifestPath = mImportCacheFolder;
+		manifestPath.append(IMPORT_CACHE_MANIFEST_NAME);
+
+		ResourceManifest::save(mImportCacheManifest, manifestPath, mImportCacheFolder);
+	}
+
+	void Importer::removeFromImportCache(const String& prefix)
+	{
+		Vector<std::pair<UUID, Path>> staleEntries;
+		for(auto& entry : mImportCacheManifest->getEntries())
+		{
+			if(StringUtil::startsWith(entry.second.getFilename(), prefix, false))
+				staleEntries.push_back(entry);
+		}
+
+		for(auto& entry : staleEntries)
+		{
+			mImportCacheManifest->unregisterResource(entry.first);
+
+			if(FileSystem::isFile(entry.second))
+				FileSystem::remove(entry.second);
+		}
+	}
+
 	void Importer::_registerAssetImporter(SpecificImporter* importer)
 	{
 		if(!importer)
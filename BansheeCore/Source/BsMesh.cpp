@@ -273,6 +273,14 @@ namespace BansheeEngine
 		return mIndexBuffer;
 	}
 
+	UINT32 Mesh::calculateSize() const
+	{
+		UINT32 indexSize = mIndexType == IndexBuffer::IT_16BIT ? sizeof(UINT16) : sizeof(UINT32);
+		UINT32 vertexSize = mVertexDesc != nullptr ? mVertexDesc->getVertexStride() : 0;
+
+		return mNumVertices * vertexSize + mNumIndices * indexSize;
+	}
+
 	void Mesh::initialize()
 	{
 		if (mTempInitialMeshData != nullptr)
@@ -4,6 +4,7 @@
 #include "BsPixelUtil.h"
 #include "BsBitwise.h"
 #include "BsColor.h"
+#include "BsParallel.h"
 #include "BsMath.h"
 #include "BsException.h"
 #include "nvtt/nvtt.h"
@@ -1442,34 +1443,36 @@ namespace BansheeEngine
         UINT8 *dstptr = static_cast<UINT8*>(dst.getData())
             + (dst.getLeft() + dst.getTop() * dst.getRowPitch() + dst.getFront() * dst.getSlicePitch()) * dstPixelSize;
 		
-        // Calculate pitches+skips in bytes
-		const UINT32 srcRowSkipBytes = src.getRowSkip()*srcPixelSize;
-		const UINT32 srcSliceSkipBytes = src.getSliceSkip()*srcPixelSize;
-		const UINT32 dstRowSkipBytes = dst.getRowSkip()*dstPixelSize;
-		const UINT32 dstSliceSkipBytes = dst.getSliceSkip()*dstPixelSize;
-
-        // The brute force fallback
-        float r,g,b,a;
-		for (UINT32 z = src.getFront(); z<src.getBack(); z++)
+        // Calculate pitches in bytes
+		const UINT32 srcRowPitchBytes = src.getRowPitch()*srcPixelSize;
+		const UINT32 srcSlicePitchBytes = src.getSlicePitch()*srcPixelSize;
+		const UINT32 dstRowPitchBytes = dst.getRowPitch()*dstPixelSize;
+		const UINT32 dstSlicePitchBytes = dst.getSlicePitch()*dstPixelSize;
+
+		const UINT32 width = src.getWidth();
+		const UINT32 height = src.getHeight();
+
+        // The brute force fallback. Rows are independent so they're converted in parallel, in chunks of
+		// at least a few thousand pixels so small images don't pay the scheduling cost.
+		const UINT32 rowsPerChunk = std::max(1U, 4096 / std::max(1U, width));
+		parallelFor(0, src.getDepth() * height, [&](UINT32 rowIdx)
 		{
-			for (UINT32 y = src.getTop(); y < src.getBottom(); y++)
-            {
-				for (UINT32 x = src.getLeft(); x<src.getRight(); x++)
-                {
-                    unpackColor(&r, &g, &b, &a, src.getFormat(), srcptr);
-                    packColor(r, g, b, a, dst.getFormat(), dstptr);
+			UINT32 z = rowIdx / height;
+			UINT32 y = rowIdx % height;
 
-                    srcptr += srcPixelSize;
-                    dstptr += dstPixelSize;
-                }
+			UINT8* srcRowPtr = srcptr + z * srcSlicePitchBytes + y * srcRowPitchBytes;
+			UINT8* dstRowPtr = dstptr + z * dstSlicePitchBytes + y * dstRowPitchBytes;
 
-                srcptr += srcRowSkipBytes;
-                dstptr += dstRowSkipBytes;
-            }
+			float r, g, b, a;
+			for (UINT32 x = 0; x < width; x++)
+			{
+				unpackColor(&r, &g, &b, &a, src.getFormat(), srcRowPtr);
+				packColor(r, g, b, a, dst.getFormat(), dstRowPtr);
 
-            srcptr += srcSliceSkipBytes;
-            dstptr += dstSliceSkipBytes;
-        }
+				srcRowPtr += srcPixelSize;
+				dstRowPtr += dstPixelSize;
+			}
+		}, rowsPerChunk);
     }
 
 	void PixelUtil::scale(const PixelData& src, PixelData& scaled, Filter filter)
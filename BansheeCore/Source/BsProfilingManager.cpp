@@ -8,6 +8,23 @@ namespace BansheeEngine
 {
 	const UINT32 ProfilingManager::NUM_SAVED_FRAMES = 200;
 
+	/**
+	 * @brief	Fills out the provided report with the current memory tracker statistics.
+	 */
+	static void generateMemoryReport(MemoryProfilerReport& report)
+	{
+#if BS_MEMORY_TRACKING_ENABLED
+		for(UINT32 i = 0; i < (UINT32)MemoryCategory::Count; i++)
+			report.categories[i] = MemoryTracker::getCategoryStats((MemoryCategory)i);
+
+		UINT32 numTags = MemoryTracker::getNumTags();
+
+		report.tags.clear();
+		for(UINT32 i = 0; i < numTags; i++)
+			report.tags.push_back(MemoryTracker::getTagStats(i));
+#endif
+	}
+
 	ProfilingManager::ProfilingManager()
 		:mSavedSimReports(nullptr), mNextSimReportIdx(0),
 		mSavedCoreReports(nullptr), mNextCoreReportIdx(0)
@@ -32,6 +49,11 @@ namespace BansheeEngine
 
 		gProfilerCPU().reset();
 
+#if BS_MEMORY_TRACKING_ENABLED
+		MemoryTracker::endFrame();
+#endif
+		generateMemoryReport(mSavedSimReports[mNextSimReportIdx].memoryReport);
+
 		mNextSimReportIdx = (mNextSimReportIdx + 1) % NUM_SAVED_FRAMES;
 #endif
 	}
@@ -44,6 +66,8 @@ namespace BansheeEngine
 
 		gProfilerCPU().reset();
 
+		generateMemoryReport(mSavedCoreReports[mNextCoreReportIdx].memoryReport);
+
 		mNextCoreReportIdx = (mNextCoreReportIdx + 1) % NUM_SAVED_FRAMES;
 #endif
 	}
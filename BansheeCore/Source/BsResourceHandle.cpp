@@ -12,6 +12,8 @@ namespace BansheeEngine
 	BS_STATIC_THREAD_SYNCHRONISER_CLASS_INSTANCE(mResourceCreatedCondition, ResourceHandleBase)
 	BS_STATIC_MUTEX_CLASS_INSTANCE(mResourceCreatedMutex, ResourceHandleBase)
 
+	static std::atomic<UINT64> ResourceUseStamp(1);
+
 	ResourceHandleBase::ResourceHandleBase()
 	{
 		mData = nullptr;
@@ -27,24 +29,36 @@ namespace BansheeEngine
 		return (mData != nullptr && mData->mIsCreated && mData->mPtr != nullptr); 
 	}
 
+	void ResourceHandleBase::requestLoad() const
+	{
+		if(mData != nullptr && mData->mIsEvicted.load(std::memory_order_acquire) && Resources::isStarted())
+			gResources().loadFromUUIDAsync(mData->mUUID);
+	}
+
 	void ResourceHandleBase::synchronize() const
 	{
 		if(mData == nullptr)
 			return;
 
+		if(mData->mIsEvicted.load(std::memory_order_acquire) && Resources::isStarted())
+			gResources().loadFromUUID(mData->mUUID);
+
 		if(!mData->mIsCreated)
 		{
 			BS_LOCK_MUTEX_NAMED(mResourceCreatedMutex, lock);
-			while(!mData->mIsCreated)
+			while(!mData->mIsCreated && !mData->mIsLoadFailed)
 			{
 				BS_THREAD_WAIT(mResourceCreatedCondition, mResourceCreatedMutex, lock);
 			}
 		}
 
+		if(!mData->mIsCreated) // Load failed
+			return;
+
 		mData->mPtr->synchronize();
 	}
 
-	void ResourceHandleBase::_setHandleData(std::shared_ptr<Resource> ptr, const String& uuid)
+	void ResourceHandleBase::_setHandleData(std::shared_ptr<Resource> ptr, const UUID& uuid)
 	{
 		mData->mPtr = ptr;
 
@@ -64,12 +78,43 @@ namespace BansheeEngine
 		}
 	}
 
+	void ResourceHandleBase::_notifyLoadFailed()
+	{
+		{
+			BS_LOCK_MUTEX(mResourceCreatedMutex);
+			mData->mIsLoadFailed = true;
+		}
+
+		BS_THREAD_NOTIFY_ALL(mResourceCreatedCondition);
+	}
+
+	void ResourceHandleBase::_markAsUsed() const
+	{
+		if(mData == nullptr)
+			return;
+
+		// Avoid writing to the shared handle data on every access
+		UINT64 useStamp = ResourceUseStamp.load(std::memory_order_relaxed);
+		if(mData->mLastUsed.load(std::memory_order_relaxed) != useStamp)
+			mData->mLastUsed.store(useStamp, std::memory_order_relaxed);
+	}
+
+	void ResourceHandleBase::_advanceUseStamp()
+	{
+		ResourceUseStamp.fetch_add(1, std::memory_order_relaxed);
+	}
+
 	void ResourceHandleBase::throwIfNotLoaded() const
 	{
+		// Evicted resources are only reloaded asynchronously, as accessors may be called from any thread
+		requestLoad();
+
 		if(!isLoaded()) 
 		{
 			BS_EXCEPT(InternalErrorException, "Trying to access a resource that hasn't been loaded yet.");
 		}
+
+		_markAsUsed();
 	}
 
 	RTTITypeBase* ResourceHandleBase::getRTTIStatic()
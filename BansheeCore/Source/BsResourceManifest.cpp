@@ -30,7 +30,7 @@ namespace BansheeEngine
 		return bs_shared_ptr<ResourceManifest>(ConstructPrivately());
 	}
 
-	void ResourceManifest::registerResource(const String& uuid, const Path& filePath)
+	void ResourceManifest::registerResource(const UUID& uuid, const Path& filePath)
 	{
 		auto iterFind = mUUIDToFilePath.find(uuid);
 
@@ -51,7 +51,7 @@ namespace BansheeEngine
 		}
 	}
 
-	void ResourceManifest::unregisterResource(const String& uuid)
+	void ResourceManifest::unregisterResource(const UUID& uuid)
 	{
 		auto iterFind = mUUIDToFilePath.find(uuid);
 
@@ -62,7 +62,7 @@ namespace BansheeEngine
 		}
 	}
 
-	bool ResourceManifest::uuidToFilePath(const String& uuid, Path& filePath) const
+	bool ResourceManifest::uuidToFilePath(const UUID& uuid, Path& filePath) const
 	{
 		auto iterFind = mUUIDToFilePath.find(uuid);
 
@@ -78,7 +78,7 @@ namespace BansheeEngine
 		}
 	}
 
-	bool ResourceManifest::filePathToUUID(const Path& filePath, String& outUUID) const
+	bool ResourceManifest::filePathToUUID(const Path& filePath, UUID& outUUID) const
 	{
 		auto iterFind = mFilePathToUUID.find(filePath);
 
@@ -89,12 +89,12 @@ namespace BansheeEngine
 		}
 		else
 		{
-			outUUID = StringUtil::BLANK;
+			outUUID = UUID::EMPTY;
 			return false;
 		}
 	}
 
-	bool ResourceManifest::uuidExists(const String& uuid) const
+	bool ResourceManifest::uuidExists(const UUID& uuid) const
 	{
 		auto iterFind = mUUIDToFilePath.find(uuid);
 
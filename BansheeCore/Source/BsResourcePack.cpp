@@ -0,0 +1,232 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsResourcePack.h"
+#include "BsResourceManifest.h"
+#include "BsFileSerializer.h"
+#include "BsBinarySerializer.h"
+#include "BsMemoryMappedFile.h"
+#include "BsCompression.h"
+#include "BsFileSystem.h"
+#include "BsDataStream.h"
+#include "BsException.h"
+
+namespace BansheeEngine
+{
+	ResourcePack::ResourcePack(const Path& filePath)
+		:mPath(filePath), mEntries(nullptr), mNumEntries(0)
+	{
+		mFile = bs_shared_ptr<MemoryMappedFile>(filePath);
+
+		const UINT8* data = mFile->getData();
+		UINT64 fileSize = mFile->getSize();
+
+		Header header;
+		if(fileSize < sizeof(header))
+			BS_EXCEPT(InternalErrorException, "Invalid resource pack: " + filePath.toString());
+
+		memcpy(&header, data, sizeof(header));
+
+		if(header.magic != PACK_MAGIC)
+			BS_EXCEPT(InternalErrorException, "Invalid resource pack: " + filePath.toString());
+
+		if(header.version != PACK_VERSION)
+			BS_EXCEPT(InternalErrorException, "Unsupported resource pack version: " + toString(header.version));
+
+		UINT64 entryTableSize = (UINT64)header.numEntries * sizeof(Entry);
+		if(header.entryTableOffset > fileSize || entryTableSize > (fileSize - header.entryTableOffset) ||
+			(header.entryTableOffset % sizeof(UINT64)) != 0)
+		{
+			BS_EXCEPT(InternalErrorException, "Invalid resource pack table of contents: " + filePath.toString());
+		}
+
+		mEntries = (const Entry*)(data + header.entryTableOffset);
+		mNumEntries = header.numEntries;
+
+		for(UINT32 i = 0; i < mNumEntries; i++)
+		{
+			const Entry& entry = mEntries[i];
+
+			if(entry.offset > fileSize || entry.size > (fileSize - entry.offset) ||
+				entry.metaDataOffset > fileSize || entry.metaDataSize > (fileSize - entry.metaDataOffset))
+			{
+				BS_EXCEPT(InternalErrorException, "Invalid resource pack table of contents: " + filePath.toString());
+			}
+		}
+	}
+
+	bool ResourcePack::contains(const UUID& uuid) const
+	{
+		return findEntry(uuid) != nullptr;
+	}
+
+	std::shared_ptr<IReflectable> ResourcePack::decode(const UUID& uuid, ResourceLoadMode loadMode) const
+	{
+		const Entry* entry = findEntry(uuid);
+		if(entry == nullptr)
+			return nullptr;
+
+		UINT8* data = mFile->getData() + entry->offset;
+
+		FileSerializer fs;
+		if(entry->size == entry->uncompressedSize)
+		{
+			std::shared_ptr<void> dataOwner;
+			if(loadMode == ResourceLoadMode::MemoryMapped)
+				dataOwner = mFile;
+
+			return fs.decode(data, entry->size, dataOwner);
+		}
+
+		// Any temporaries used during decoding are released at once when this ends
+		ScratchScope scratchScope;
+
+		UINT8* uncompressedData = (UINT8*)bs_alloc<ScratchAlloc>((size_t)entry->uncompressedSize);
+		if(!Compression::decompress(data, (UINT32)entry->size, uncompressedData, (UINT32)entry->uncompressedSize))
+		{
+			bs_free<ScratchAlloc>(uncompressedData);
+			BS_EXCEPT(InternalErrorException, "Resource pack contents are corrupt: " + mPath.toString());
+		}
+
+		// Decompressed data is released once decoding ends, so data blocks can't reference it in place
+		std::shared_ptr<IReflectable> object = fs.decode(uncompressedData, entry->uncompressedSize);
+
+		bs_free<ScratchAlloc>(uncompressedData);
+		return object;
+	}
+
+	std::shared_ptr<IReflectable> ResourcePack::decodeMetaData(const UUID& uuid) const
+	{
+		const Entry* entry = findEntry(uuid);
+		if(entry == nullptr)
+			return nullptr;
+
+		if(entry->metaDataSize == 0)
+			return nullptr;
+
+		BinarySerializer bs;
+		return bs.decode(mFile->getData() + entry->metaDataOffset, (UINT32)entry->metaDataSize);
+	}
+
+	void ResourcePack::create(const ResourceManifestPtr& manifest, const Path& filePath, bool compress)
+	{
+		static const UINT32 ALIGNMENT = BinarySerializer::DATA_BLOCK_ALIGNMENT;
+
+		// Entries are sorted by UUID so they can be found using a binary search
+		Vector<std::pair<UUID, Path>> resources;
+		for(auto& entry : manifest->getEntries())
+		{
+			if(FileSystem::isFile(entry.second))
+				resources.push_back(entry);
+		}
+
+		std::sort(resources.begin(), resources.end(), 
+			[](const std::pair<UUID, Path>& a, const std::pair<UUID, Path>& b) { return a.first < b.first; });
+
+		DataStreamPtr output = FileSystem::createAndOpenFile(filePath);
+
+		// Header is written once all entries are known
+		Header header;
+		memset(&header, 0, sizeof(header));
+		output->write(&header, sizeof(header));
+
+		UINT8 padding[ALIGNMENT];
+		memset(padding, 0, sizeof(padding));
+
+		UINT64 offset = sizeof(header);
+		Vector<Entry> entries;
+		Vector<UINT8> fileData;
+		Vector<UINT8> compressedData;
+
+		for(auto& resource : resources)
+		{
+			DataStreamPtr input = FileSystem::openFile(resource.second);
+
+			fileData.resize(input->size());
+			if(!fileData.empty())
+				input->read(&fileData[0], fileData.size());
+
+			input->close();
+
+			UINT32 paddingSize = (UINT32)((ALIGNMENT - (offset % ALIGNMENT)) % ALIGNMENT);
+			output->write(padding, paddingSize);
+			offset += paddingSize;
+
+			const UINT8* data = fileData.empty() ? nullptr : &fileData[0];
+
+			// Meta data is split from the resource data, as it needs to be readable without decompressing the resource
+			UINT64 dataSize = fileData.size();
+			UINT64 metaDataOffset = 0;
+			UINT32 metaDataSize = 0;
+			if(FileSerializer::findMetaData(data, fileData.size(), metaDataOffset, metaDataSize))
+				dataSize = metaDataOffset;
+
+			Entry entry;
+			entry.offset = offset;
+			entry.size = dataSize;
+			entry.uncompressedSize = dataSize;
+			entry.metaDataOffset = 0;
+			entry.metaDataSize = metaDataSize;
+			entry.uuid = resource.first;
+
+			const UINT8* entryData = data;
+			if(compress && dataSize > 0 && dataSize <= (std::numeric_limits<UINT32>::max() / 2))
+			{
+				UINT32 maxCompressedSize = Compression::getMaxCompressedSize((UINT32)dataSize);
+				compressedData.resize(maxCompressedSize);
+
+				// Store resources that don't compress as they are
+				UINT32 compressedSize = Compression::compress(data, (UINT32)dataSize, &compressedData[0], maxCompressedSize);
+				if(compressedSize > 0 && compressedSize < dataSize)
+				{
+					entryData = &compressedData[0];
+					entry.size = compressedSize;
+				}
+			}
+
+			if(entry.size > 0)
+				output->write(entryData, (size_t)entry.size);
+
+			offset += entry.size;
+
+			if(metaDataSize > 0)
+			{
+				entry.metaDataOffset = offset;
+				output->write(data + metaDataOffset, metaDataSize);
+
+				offset += metaDataSize;
+			}
+
+			entries.push_back(entry);
+		}
+
+		UINT32 paddingSize = (UINT32)((ALIGNMENT - (offset % ALIGNMENT)) % ALIGNMENT);
+		output->write(padding, paddingSize);
+		offset += paddingSize;
+
+		header.entryTableOffset = offset;
+		header.numEntries = (UINT32)entries.size();
+
+		if(!entries.empty())
+			output->write(&entries[0], entries.size() * sizeof(Entry));
+
+		header.magic = PACK_MAGIC;
+		header.version = PACK_VERSION;
+
+		output->seek(0);
+		output->write(&header, sizeof(header));
+		output->close();
+	}
+
+	const ResourcePack::Entry* ResourcePack::findEntry(const UUID& uuid) const
+	{
+		const Entry* entriesEnd = mEntries + mNumEntries;
+		const Entry* entry = std::lower_bound(mEntries, entriesEnd, uuid, 
+			[](const Entry& entry, const UUID& uuid) { return entry.uuid < uuid; });
+
+		if(entry != entriesEnd && entry->uuid == uuid)
+			return entry;
+
+		return nullptr;
+	}
+}
\ No newline at end of file
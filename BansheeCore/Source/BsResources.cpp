@@ -4,17 +4,75 @@
 #include "BsResources.h"
 #include "BsResource.h"
 #include "BsResourceManifest.h"
+#include "BsResourceHandle.h"
+#include "BsSavedResourceData.h"
+#include "BsResourcePack.h"
 #include "BsException.h"
 #include "BsFileSerializer.h"
 #include "BsFileSystem.h"
+#include "BsDataStream.h"
+#include "BsMemoryMappedFile.h"
 #include "BsTaskScheduler.h"
-#include "BsUUID.h"
+#include "BsUUIDGenerator.h"
 #include "BsPath.h"
 #include "BsDebug.h"
 
 namespace BansheeEngine
 {
+	/**
+	 * @brief	Dependencies of the resource that is being loaded on the current thread.
+	 */
+	struct ResourceLoadContext
+	{
+		UnorderedMap<UUID, HResource> dependencies;
+		Vector<std::pair<HResource, HResource>> pendingHandles; /**< Deserialized handle, and the dependency it references. */
+	};
+
+	static BS_THREADLOCAL ResourceLoadContext* ActiveLoadContext = nullptr;
+
+	/**
+	 * @brief	UUID of the resource whose load is waiting on another load on the current thread. Loads the thread runs
+	 *			while it waits must finish before the waiting load can continue.
+	 */
+	static BS_THREADLOCAL const UUID* ActiveWaitingLoad = nullptr;
+
+	/**
+	 * @brief	Makes a context active on the current thread while the scope is active, restoring the
+	 *			previous context when the scope ends.
+	 */
+	template<class T>
+	struct ActiveContextScope
+	{
+		ActiveContextScope(T*& activeContext, T* context)
+			:mActiveContext(activeContext), mPrevContext(activeContext)
+		{
+			mActiveContext = context;
+		}
+
+		~ActiveContextScope()
+		{
+			mActiveContext = mPrevContext;
+		}
+
+		T*& mActiveContext;
+		T* mPrevContext;
+	};
+
+	ResourceSaveContext::ResourceSaveContext(SavedResourceData& resourceData)
+		:mResourceData(resourceData)
+	{ }
+
+	void ResourceSaveContext::addDependency(const UUID& uuid)
+	{
+		if(uuid.empty())
+			return;
+
+		BS_LOCK_MUTEX(mMutex);
+		mResourceData.addDependency(uuid);
+	}
+
 	Resources::Resources()
+		:mMemoryUsage(0), mMemoryBudget(0)
 	{
 		mDefaultResourceManifest = ResourceManifest::create("Default");
 		mResourceManifests.push_back(mDefaultResourceManifest);
@@ -23,29 +81,41 @@ namespace BansheeEngine
 	Resources::~Resources()
 	{
 		// Unload and invalidate all resources
-		UnorderedMap<String, HResource> loadedResourcesCopy = mLoadedResources;
+		UnorderedMap<UUID, HResource> loadedResourcesCopy = mLoadedResources;
 
 		for (auto& loadedResourcePair : loadedResourcesCopy)
 		{
 			unload(loadedResourcePair.second);
 
 			// Invalidate the handle
-			loadedResourcePair.second._setHandleData(nullptr, "");
+			loadedResourcePair.second._setHandleData(nullptr, UUID::EMPTY);
 		}
+
+		for (auto& evictedResourcePair : mEvictedResources)
+		{
+			evictedResourcePair.second.getHandleData()->mIsEvicted.store(false, std::memory_order_release);
+			evictedResourcePair.second._setHandleData(nullptr, UUID::EMPTY);
+		}
+
+		mEvictedResources.clear();
 	}
 
-	HResource Resources::load(const Path& filePath)
+	HResource Resources::load(const Path& filePath, ResourceLoadMode loadMode)
 	{
-		return loadInternal(filePath, true);
+		return loadInternal(filePath, true, loadMode);
 	}
 
-	HResource Resources::loadAsync(const Path& filePath)
+	HResource Resources::loadAsync(const Path& filePath, ResourceLoadMode loadMode)
 	{
-		return loadInternal(filePath, false);
+		return loadInternal(filePath, false, loadMode);
 	}
 
-	HResource Resources::loadFromUUID(const String& uuid)
+	HResource Resources::loadFromUUID(const UUID& uuid, ResourceLoadMode loadMode)
 	{
+		ResourcePackPtr pack = findPack(uuid);
+		if(pack != nullptr)
+			return loadInternal(uuid, Path::BLANK, pack, true, loadMode);
+
 		Path filePath;
 		bool foundPath = false;
 
@@ -62,15 +132,19 @@ namespace BansheeEngine
 
 		if(!foundPath)
 		{
-			gDebug().logWarning("Cannot load resource. Resource with UUID '" + uuid + "' doesn't exist.");
+			gDebug().logWarning("Cannot load resource. Resource with UUID '" + uuid.toString() + "' doesn't exist.");
 			return HResource();
 		}
 
-		return load(filePath);
+		return load(filePath, loadMode);
 	}
 
-	HResource Resources::loadFromUUIDAsync(const String& uuid)
+	HResource Resources::loadFromUUIDAsync(const UUID& uuid, ResourceLoadMode loadMode)
 	{
+		ResourcePackPtr pack = findPack(uuid);
+		if(pack != nullptr)
+			return loadInternal(uuid, Path::BLANK, pack, false, loadMode);
+
 		Path filePath;
 		bool foundPath = false;
 
@@ -85,16 +159,16 @@ namespace BansheeEngine
 
 		if(!foundPath)
 		{
-			gDebug().logWarning("Cannot load resource. Resource with UUID '" + uuid + "' doesn't exist.");
+			gDebug().logWarning("Cannot load resource. Resource with UUID '" + uuid.toString() + "' doesn't exist.");
 			return HResource();
 		}
 
-		return loadAsync(filePath);
+		return loadAsync(filePath, loadMode);
 	}
 
-	HResource Resources::loadInternal(const Path& filePath, bool synchronous)
+	HResource Resources::loadInternal(const Path& filePath, bool synchronous, ResourceLoadMode loadMode)
 	{
-		String uuid;
+		UUID uuid;
 		bool foundUUID = false;
 		for(auto iter = mResourceManifests.rbegin(); iter != mResourceManifests.rend(); ++iter) 
 		{
@@ -108,11 +182,19 @@ namespace BansheeEngine
 		if(!foundUUID)
 			uuid = UUIDGenerator::instance().generateRandom();
 
+		return loadInternal(uuid, filePath, nullptr, synchronous, loadMode);
+	}
+
+	HResource Resources::loadInternal(const UUID& uuid, const Path& filePath, const ResourcePackPtr& pack, 
+		bool synchronous, ResourceLoadMode loadMode)
+	{
 		{
 			BS_LOCK_MUTEX(mLoadedResourceMutex);
 			auto iterFind = mLoadedResources.find(uuid);
 			if(iterFind != mLoadedResources.end()) // Resource is already loaded
 			{
+				iterFind->second._markAsUsed();
+
 				return iterFind->second;
 			}
 		}
@@ -143,39 +225,66 @@ namespace BansheeEngine
 			}
 		}
 
-		if(!FileSystem::isFile(filePath))
+		if(pack == nullptr && !FileSystem::isFile(filePath))
 		{
 			gDebug().logWarning("Specified file: " + filePath.toString() + " doesn't exist.");
 			return HResource();
 		}
 
-		HResource newResource(uuid);
+		// Handles to an evicted resource are reused, so they become valid again once it is reloaded
+		HResource newResource;
+		{
+			BS_LOCK_MUTEX(mLoadedResourceMutex);
+			auto iterFind = mEvictedResources.find(uuid);
+			if(iterFind != mEvictedResources.end())
+			{
+				newResource = iterFind->second;
+				newResource.getHandleData()->mIsEvicted.store(false, std::memory_order_release);
+
+				mEvictedResources.erase(iterFind);
+			}
+			else
+				newResource = HResource(uuid);
+		}
+
+		TaskPtr task;
+		if(!synchronous)
+		{
+			String fileName = pack != nullptr ? uuid.toString() : filePath.getFilename();
+			String taskName = "Resource load: " + fileName;
+
+			task = Task::create(taskName, std::bind(&Resources::loadCallback, this, filePath, pack, newResource, loadMode, false));
+		}
 
 		{
 			BS_LOCK_MUTEX(mInProgressResourcesMutex);
 			mInProgressResources[uuid] = newResource;
+
+			if(task != nullptr)
+				mLoadTasks[uuid] = task;
 		}
 
 		if(synchronous)
-		{
-			loadCallback(filePath, newResource);
-		}
+			loadCallback(filePath, pack, newResource, loadMode, true);
 		else
-		{
-			String fileName = filePath.getFilename();
-			String taskName = "Resource load: " + fileName;
-
-			TaskPtr task = Task::create(taskName, std::bind(&Resources::loadCallback, this, filePath, newResource));
 			TaskScheduler::instance().addTask(task);
-		}
 
 		return newResource;
 	}
 
-	ResourcePtr Resources::loadFromDiskAndDeserialize(const Path& filePath)
+	ResourcePtr Resources::loadFromDiskAndDeserialize(const UUID& uuid, const ResourcePackPtr& pack, 
+		const MemoryMappedFilePtr& mappedFile, const DataStreamPtr& stream, ResourceLoadMode loadMode)
 	{
+		BS_MEMORY_TAG("Resources");
+
 		FileSerializer fs;
-		std::shared_ptr<IReflectable> loadedData = fs.decode(filePath);
+		std::shared_ptr<IReflectable> loadedData;
+		if(pack != nullptr)
+			loadedData = pack->decode(uuid, loadMode);
+		else if(mappedFile != nullptr)
+			loadedData = fs.decode(mappedFile->getData(), mappedFile->getSize(), mappedFile);
+		else
+			loadedData = fs.decode(stream);
 
 		if(loadedData == nullptr)
 			BS_EXCEPT(InternalErrorException, "Unable to load resource.");
@@ -189,6 +298,16 @@ namespace BansheeEngine
 
 	void Resources::unload(HResource resource)
 	{
+		// Evicted resources are already unloaded, so there's no need to reload them just to unload them again
+		if(resource.getHandleData() != nullptr && resource.getHandleData()->mIsEvicted.load(std::memory_order_acquire))
+		{
+			BS_LOCK_MUTEX(mLoadedResourceMutex);
+			mEvictedResources.erase(resource.getUUID());
+			resource.getHandleData()->mIsEvicted.store(false, std::memory_order_release);
+
+			return;
+		}
+
 		if(!resource.isLoaded()) // If it's still loading wait until that finishes
 			resource.synchronize();
 
@@ -197,6 +316,7 @@ namespace BansheeEngine
 		{
 			BS_LOCK_MUTEX(mLoadedResourceMutex);
 			mLoadedResources.erase(resource.getUUID());
+			removeResident(resource.getUUID());
 		}
 	}
 
@@ -217,9 +337,183 @@ namespace BansheeEngine
 		{
 			unload(*iter);
 		}
+
+		// Forget evicted resources nothing references anymore, they will get new handles if loaded again
+		{
+			BS_LOCK_MUTEX(mLoadedResourceMutex);
+			for(auto iter = mEvictedResources.begin(); iter != mEvictedResources.end();)
+			{
+				if(iter->second.getHandleData().unique())
+				{
+					iter->second.getHandleData()->mIsEvicted.store(false, std::memory_order_release);
+					iter = mEvictedResources.erase(iter);
+				}
+				else
+					++iter;
+			}
+		}
+	}
+
+	UINT64 Resources::getMemoryUsage() const
+	{
+		BS_LOCK_MUTEX(mLoadedResourceMutex);
+		return mMemoryUsage;
+	}
+
+	UINT64 Resources::getMemoryUsage(UINT32 typeId) const
+	{
+		BS_LOCK_MUTEX(mLoadedResourceMutex);
+
+		auto iterFind = mMemoryUsagePerType.find(typeId);
+		if(iterFind != mMemoryUsagePerType.end())
+			return iterFind->second;
+
+		return 0;
+	}
+
+	void Resources::setPriority(const HResource& resource, ResourcePriority priority)
+	{
+		BS_LOCK_MUTEX(mLoadedResourceMutex);
+
+		if(priority == ResourcePriority::Normal)
+			mPriorities.erase(resource.getUUID());
+		else
+			mPriorities[resource.getUUID()] = priority;
+	}
+
+	void Resources::_update()
+	{
+		ResourceHandleBase::_advanceUseStamp();
+
+		if(mMemoryBudget == 0)
+			return;
+
+		Vector<std::pair<UINT64, HResource>> evictionCandidates;
+		{
+			BS_LOCK_MUTEX(mLoadedResourceMutex);
+			if(mMemoryUsage <= mMemoryBudget)
+				return;
+
+			for(auto& loadedResourcePair : mLoadedResources)
+			{
+				const HResource& resource = loadedResourcePair.second;
+
+				if(!isEvictable(resource, 1))
+					continue;
+
+				UINT64 lastUsed = resource.getHandleData()->mLastUsed.load(std::memory_order_relaxed);
+				evictionCandidates.push_back(std::make_pair(lastUsed, resource));
+			}
+		}
+
+		std::sort(evictionCandidates.begin(), evictionCandidates.end(), 
+			[](const std::pair<UINT64, HResource>& a, const std::pair<UINT64, HResource>& b) { return a.first < b.first; });
+
+		for(auto& candidate : evictionCandidates)
+		{
+			if(getMemoryUsage() <= mMemoryBudget)
+				break;
+
+			// Only resources that can be reloaded later are evicted
+			const UUID& uuid = candidate.second.getUUID();
+
+			Path filePath;
+			if(findPack(uuid) == nullptr && !getFilePathFromUUID(uuid, filePath))
+				continue;
+
+			evict(candidate.second);
+		}
+	}
+
+	void Resources::evict(const HResource& resource)
+	{
+		UUID uuid = resource.getUUID();
+		ResourcePtr evictedResource;
+
+		{
+			BS_LOCK_MUTEX(mLoadedResourceMutex);
+
+			// Resource might have been unloaded, or started being used elsewhere, since it was picked for eviction
+			auto iterFind = mLoadedResources.find(uuid);
+			if(iterFind == mLoadedResources.end() || iterFind->second.getHandleData() != resource.getHandleData())
+				return;
+
+			// The loaded resource list and the eviction candidate list both hold a handle
+			if(!isEvictable(resource, 2))
+				return;
+
+			mLoadedResources.erase(iterFind);
+			removeResident(uuid);
+
+			const std::shared_ptr<ResourceHandleData>& handleData = resource.getHandleData();
+			evictedResource = handleData->mPtr;
+
+			// Only the eviction candidate list remains if nothing else references the resource
+			if(handleData.use_count() > 1)
+			{
+				handleData->mIsCreated = false;
+				handleData->mPtr = nullptr;
+				handleData->mIsEvicted.store(true, std::memory_order_release);
+
+				mEvictedResources[uuid] = resource;
+			}
+		}
+
+		// Resource can no longer be reached through the loaded resource list, so it's safe to destroy it unlocked
+		evictedResource->destroy();
+	}
+
+	bool Resources::isEvictable(const HResource& resource, UINT32 numInternalHandles) const
+	{
+		ResourcePriority priority = ResourcePriority::Normal;
+		auto iterFindPriority = mPriorities.find(resource.getUUID());
+		if(iterFindPriority != mPriorities.end())
+			priority = iterFindPriority->second;
+
+		if(priority == ResourcePriority::High)
+			return false;
+
+		// Something other than a handle uses the resource (e.g. a core thread object)
+		const std::shared_ptr<ResourceHandleData>& handleData = resource.getHandleData();
+		if(handleData->mPtr == nullptr || !handleData->mPtr.unique())
+			return false;
+
+		bool hasHandles = handleData.use_count() > (long)numInternalHandles;
+		if(hasHandles && priority != ResourcePriority::Low)
+			return false;
+
+		return true;
+	}
+
+	void Resources::addResident(const UUID& uuid, const ResourcePtr& resource)
+	{
+		removeResident(uuid);
+
+		if(resource == nullptr)
+			return;
+
+		ResidencyInfo& info = mResidencyInfo[uuid];
+		info.size = resource->calculateSize();
+		info.typeId = resource->getTypeId();
+
+		mMemoryUsage += info.size;
+		mMemoryUsagePerType[info.typeId] += info.size;
 	}
 
-	void Resources::save(HResource resource, const Path& filePath, bool overwrite)
+	void Resources::removeResident(const UUID& uuid)
+	{
+		auto iterFind = mResidencyInfo.find(uuid);
+		if(iterFind == mResidencyInfo.end())
+			return;
+
+		const ResidencyInfo& info = iterFind->second;
+		mMemoryUsage -= info.size;
+		mMemoryUsagePerType[info.typeId] -= info.size;
+
+		mResidencyInfo.erase(iterFind);
+	}
+
+	void Resources::save(HResource resource, const Path& filePath, bool overwrite, bool parallel)
 	{
 		if(!resource.isLoaded())
 			resource.synchronize();
@@ -235,8 +529,12 @@ namespace BansheeEngine
 
 		mDefaultResourceManifest->registerResource(resource.getUUID(), filePath);
 
+		// Resources referenced by handles are recorded as dependencies while the resource is being encoded
+		SavedResourceData resourceData;
+		ResourceSaveContext saveContext(resourceData);
+
 		FileSerializer fs;
-		fs.encode(resource.get(), filePath);
+		fs.encode(resource.get(), filePath, false, &resourceData, parallel, &saveContext);
 	}
 
 	void Resources::registerResourceManifest(const ResourceManifestPtr& manifest)
@@ -262,21 +560,104 @@ namespace BansheeEngine
 		return nullptr;
 	}
 
+	void Resources::mountPack(const Path& filePath)
+	{
+		ResourcePackPtr pack = bs_shared_ptr<ResourcePack>(filePath);
+
+		BS_LOCK_MUTEX(mResourcePacksMutex);
+		mResourcePacks.push_back(pack);
+	}
+
+	void Resources::unmountPack(const Path& filePath)
+	{
+		BS_LOCK_MUTEX(mResourcePacksMutex);
+
+		auto findIter = std::find_if(mResourcePacks.begin(), mResourcePacks.end(), 
+			[&](const ResourcePackPtr& pack) { return pack->getPath() == filePath; });
+
+		if(findIter != mResourcePacks.end())
+			mResourcePacks.erase(findIter);
+	}
+
+	ResourcePackPtr Resources::findPack(const UUID& uuid) const
+	{
+		BS_LOCK_MUTEX(mResourcePacksMutex);
+
+		for(auto iter = mResourcePacks.rbegin(); iter != mResourcePacks.rend(); ++iter) 
+		{
+			if((*iter)->contains(uuid))
+				return *iter;
+		}
+
+		return nullptr;
+	}
+
 	HResource Resources::_createResourceHandle(const ResourcePtr& obj)
 	{
-		String uuid = UUIDGenerator::instance().generateRandom();
+		UUID uuid = UUIDGenerator::instance().generateRandom();
 		HResource newHandle(obj, uuid);
 
 		{
 			BS_LOCK_MUTEX(mLoadedResourceMutex);
 
 			mLoadedResources[uuid] = newHandle;
+			addResident(uuid, obj);
+			newHandle._markAsUsed();
 		}
 	
 		return newHandle;
 	}
 
-	bool Resources::getFilePathFromUUID(const String& uuid, Path& filePath) const
+	HResource Resources::getLoadedResource(const UUID& uuid) const
+	{
+		BS_LOCK_MUTEX(mLoadedResourceMutex);
+
+		auto iterFind = mLoadedResources.find(uuid);
+		if(iterFind != mLoadedResources.end())
+			return iterFind->second;
+
+		return HResource();
+	}
+
+	void Resources::_resolveDeserializedHandle(ResourceHandleBase& handle)
+	{
+		if(handle.mData == nullptr || handle.mData->mUUID.empty())
+			return;
+
+		UUID uuid = handle.mData->mUUID;
+
+		ResourceLoadContext* loadContext = ActiveLoadContext;
+		if(loadContext != nullptr)
+		{
+			// Resources referenced by a resource being loaded are loaded in parallel with it. Loading them synchronously
+			// here could wait forever on a resource whose load is itself waiting on the one being loaded.
+			auto findIter = loadContext->dependencies.find(uuid);
+			if(findIter == loadContext->dependencies.end())
+			{
+				HResource dependencyHandle = loadFromUUIDAsync(uuid);
+				if(dependencyHandle.getHandleData() == nullptr)
+					return;
+
+				findIter = loadContext->dependencies.insert(std::make_pair(uuid, dependencyHandle)).first;
+			}
+
+			// Dependency might still be loading, so the handle is resolved once the resource is done loading
+			HResource deserializedHandle;
+			static_cast<ResourceHandleBase&>(deserializedHandle).mData = handle.mData;
+
+			loadContext->pendingHandles.push_back(std::make_pair(deserializedHandle, findIter->second));
+			return;
+		}
+
+		// NOTE: This will cause Resources::load to be called recursively with resources that contain other
+		// resources. This might cause problems. Keep this note here as a warning until I prove otherwise.
+		HResource loadedResource = loadFromUUID(uuid);
+
+		if(loadedResource)
+			handle._setHandleData(loadedResource.getInternalPtr(), uuid);
+	}
+
+	bool Resources::getFilePathFromUUID(const UUID& uuid, Path& filePath) const
 	{
 		for(auto iter = mResourceManifests.rbegin(); iter != mResourceManifests.rend(); ++iter) 
 		{
@@ -287,7 +668,7 @@ namespace BansheeEngine
 		return false;
 	}
 
-	bool Resources::getUUIDFromFilePath(const Path& path, String& uuid) const
+	bool Resources::getUUIDFromFilePath(const Path& path, UUID& uuid) const
 	{
 		for(auto iter = mResourceManifests.rbegin(); iter != mResourceManifests.rend(); ++iter) 
 		{
@@ -298,21 +679,214 @@ namespace BansheeEngine
 		return false;
 	}
 
-	void Resources::loadCallback(const Path& filePath, HResource& resource)
+	void Resources::loadCallback(const Path& filePath, const ResourcePackPtr& pack, HResource& resource, 
+		ResourceLoadMode loadMode, bool synchronous)
 	{
-		ResourcePtr rawResource = loadFromDiskAndDeserialize(filePath);
+		UUID uuid = resource.getUUID();
 
+		// If the thread runs this load while another load waits, the waiting load can't continue until this one is done
+		const UUID* waitingLoad = ActiveWaitingLoad;
+		if(waitingLoad != nullptr)
 		{
 			BS_LOCK_MUTEX(mInProgressResourcesMutex);
-			mInProgressResources.erase(resource.getUUID());
+			mLoadWaits[*waitingLoad].push_back(uuid);
+		}
+
+		ResourceLoadContext loadContext;
+		ResourcePtr rawResource;
+		try
+		{
+			// File is only opened once, and both the meta data and the resource are read from it
+			FileSerializer fs;
+			MemoryMappedFilePtr mappedFile;
+			DataStreamPtr stream;
+
+			std::shared_ptr<IReflectable> metaData;
+			if(pack != nullptr)
+				metaData = pack->decodeMetaData(uuid);
+			else if(loadMode == ResourceLoadMode::MemoryMapped)
+			{
+				mappedFile = bs_shared_ptr<MemoryMappedFile>(filePath);
+				metaData = fs.decodeMetaData(mappedFile->getData(), mappedFile->getSize());
+			}
+			else
+			{
+				stream = FileSystem::openFile(filePath);
+				metaData = fs.decodeMetaData(stream);
+			}
+
+			// Start loading all dependencies before the resource itself, so they load in parallel with it and each other
+			if(metaData != nullptr && metaData->isDerivedFrom(SavedResourceData::getRTTIStatic()))
+			{
+				SavedResourceDataPtr resourceData = std::static_pointer_cast<SavedResourceData>(metaData);
+				for(auto& dependency : resourceData->getDependencies())
+				{
+					if(dependency == uuid)
+						continue;
+
+					HResource dependencyHandle = loadFromUUIDAsync(dependency);
+					if(dependencyHandle.getHandleData() != nullptr)
+						loadContext.dependencies[dependency] = dependencyHandle;
+				}
+			}
+
+			{
+				ActiveContextScope<ResourceLoadContext> loadScope(ActiveLoadContext, &loadContext);
+				rawResource = loadFromDiskAndDeserialize(uuid, pack, mappedFile, stream, loadMode);
+			}
+
+			if(stream != nullptr)
+				stream->close();
+
+			if(rawResource == nullptr)
+				BS_EXCEPT(InternalErrorException, "Unable to load resource.");
+		}
+		catch(const std::exception& e)
+		{
+			// Nothing else will finish this load, so stop tracking it and wake up anyone waiting on it
+			finishLoad(uuid, waitingLoad);
+			resource._notifyLoadFailed();
+
+			if(synchronous)
+				throw;
+
+			gDebug().logError("Failed to load resource with UUID '" + uuid.toString() + "'. " + e.what());
+			return;
 		}
 
-		resource._setHandleData(rawResource, resource.getUUID());
+		// Resource only becomes available once all of its dependencies are, except for dependencies that reference
+		// it back. Their handles to the resource are resolved once it is done loading.
+		for(auto& dependency : loadContext.dependencies)
+			waitUntilLoaded(uuid, dependency.second);
+
+		for(auto& pendingHandle : loadContext.pendingHandles)
+			resolveWhenLoaded(pendingHandle.first, pendingHandle.second);
+
+		resource._setHandleData(rawResource, uuid);
 
 		{
 			BS_LOCK_MUTEX(mLoadedResourceMutex);
-			mLoadedResources[resource.getUUID()] = resource;
+			mLoadedResources[uuid] = resource;
+			addResident(uuid, rawResource);
+			resource._markAsUsed();
+		}
+
+		Vector<HResource> deferredHandles = finishLoad(uuid, waitingLoad);
+		for(auto& deferredHandle : deferredHandles)
+			deferredHandle._setHandleData(rawResource, uuid);
+	}
+
+	Vector<HResource> Resources::finishLoad(const UUID& uuid, const UUID* waitingLoad)
+	{
+		Vector<HResource> deferredHandles;
+
+		BS_LOCK_MUTEX(mInProgressResourcesMutex);
+		mInProgressResources.erase(uuid);
+		mLoadTasks.erase(uuid);
+		mLoadWaits.erase(uuid);
+
+		if(waitingLoad != nullptr)
+		{
+			auto iterFindWaits = mLoadWaits.find(*waitingLoad);
+			if(iterFindWaits != mLoadWaits.end())
+			{
+				Vector<UUID>& waits = iterFindWaits->second;
+
+				auto iterFind = std::find(waits.begin(), waits.end(), uuid);
+				if(iterFind != waits.end())
+					waits.erase(iterFind);
+			}
+		}
+
+		auto iterFindDeferred = mDeferredHandles.find(uuid);
+		if(iterFindDeferred != mDeferredHandles.end())
+		{
+			deferredHandles = std::move(iterFindDeferred->second);
+			mDeferredHandles.erase(iterFindDeferred);
+		}
+
+		return deferredHandles;
+	}
+
+	void Resources::waitUntilLoaded(const UUID& waitingLoad, const HResource& resource)
+	{
+		const UUID& uuid = resource.getUUID();
+
+		TaskPtr task;
+		{
+			BS_LOCK_MUTEX(mInProgressResourcesMutex);
+			if(mInProgressResources.find(uuid) == mInProgressResources.end())
+				return;
+
+			// Cyclic reference, neither load would ever finish
+			if(isLoadWaitingOn(uuid, waitingLoad))
+				return;
+
+			mLoadWaits[waitingLoad].push_back(uuid);
+
+			auto findIter = mLoadTasks.find(uuid);
+			if(findIter != mLoadTasks.end())
+				task = findIter->second;
 		}
+
+		{
+			ActiveContextScope<const UUID> waitScope(ActiveWaitingLoad, &waitingLoad);
+
+			if(task != nullptr)
+				task->wait();
+			else // Being loaded synchronously by another thread
+				resource.synchronize();
+		}
+
+		{
+			BS_LOCK_MUTEX(mInProgressResourcesMutex);
+			Vector<UUID>& waits = mLoadWaits[waitingLoad];
+
+			auto iterFind = std::find(waits.begin(), waits.end(), uuid);
+			if(iterFind != waits.end())
+				waits.erase(iterFind);
+		}
+	}
+
+	bool Resources::isLoadWaitingOn(const UUID& load, const UUID& otherLoad) const
+	{
+		UnorderedSet<UUID> visited;
+		Vector<UUID> toVisit;
+		toVisit.push_back(load);
+
+		while(!toVisit.empty())
+		{
+			UUID current = toVisit.back();
+			toVisit.pop_back();
+
+			if(current == otherLoad)
+				return true;
+
+			if(!visited.insert(current).second)
+				continue;
+
+			auto iterFind = mLoadWaits.find(current);
+			if(iterFind != mLoadWaits.end())
+				toVisit.insert(toVisit.end(), iterFind->second.begin(), iterFind->second.end());
+		}
+
+		return false;
+	}
+
+	void Resources::resolveWhenLoaded(HResource& handle, const HResource& resource)
+	{
+		if(!resource.isLoaded())
+		{
+			BS_LOCK_MUTEX(mInProgressResourcesMutex);
+			if(mInProgressResources.find(resource.getUUID()) != mInProgressResources.end())
+			{
+				mDeferredHandles[resource.getUUID()].push_back(handle);
+				return;
+			}
+		}
+
+		if(resource.isLoaded())
+			handle._setHandleData(resource.getInternalPtr(), resource.getUUID());
 	}
 
 	BS_CORE_EXPORT Resources& gResources()
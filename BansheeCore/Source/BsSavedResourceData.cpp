@@ -0,0 +1,31 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsSavedResourceData.h"
+#include "BsSavedResourceDataRTTI.h"
+
+namespace BansheeEngine
+{
+	SavedResourceData::SavedResourceData()
+	{ }
+
+	void SavedResourceData::addDependency(const UUID& uuid)
+	{
+		auto findIter = std::find(mDependencies.begin(), mDependencies.end(), uuid);
+		if(findIter == mDependencies.end())
+			mDependencies.push_back(uuid);
+	}
+
+	/************************************************************************/
+	/* 								SERIALIZATION                      		*/
+	/************************************************************************/
+	RTTITypeBase* SavedResourceData::getRTTIStatic()
+	{
+		return SavedResourceDataRTTI::instance();
+	}
+
+	RTTITypeBase* SavedResourceData::getRTTI() const
+	{
+		return SavedResourceData::getRTTIStatic();
+	}
+}
\ No newline at end of file
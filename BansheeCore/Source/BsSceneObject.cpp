@@ -393,14 +393,17 @@ namespace BansheeEngine
 
 	HSceneObject SceneObject::clone()
 	{
-		UINT32 bufferSize = 0;
-
 		MemorySerializer serializer;
-		UINT8* buffer = serializer.encode(this, bufferSize, &bs_alloc);
+		return clone(serializer);
+	}
+
+	HSceneObject SceneObject::clone(MemorySerializer& serializer)
+	{
+		UINT32 bufferSize = 0;
+		UINT8* buffer = serializer.encodeToBuffer(this, bufferSize);
 
 		GameObjectManager::instance().startDeserialization();
 		std::shared_ptr<SceneObject> cloneObj = std::static_pointer_cast<SceneObject>(serializer.decode(buffer, bufferSize));
-		bs_free(buffer);
 		GameObjectManager::instance().endDeserialization();
 
 		return cloneObj->mThisHandle;
@@ -36,7 +36,7 @@ namespace BansheeEngine
 
 		// Adjust format if required
 		mFormat = TextureManager::instance().getNativeFormat(mTextureType, format, mUsage, hwGamma);
-		mSize = getNumFaces() * PixelUtil::getMemorySize(mWidth, mHeight, mDepth, mFormat);
+		mSize = Texture::calculateSize();
 
 		Resource::initialize();
 	}
@@ -48,7 +48,21 @@ namespace BansheeEngine
 
 	UINT32 Texture::calculateSize() const
 	{
-        return getNumFaces() * PixelUtil::getMemorySize(mWidth, mHeight, mDepth, mFormat);
+		UINT32 width = mWidth;
+		UINT32 height = mHeight;
+		UINT32 depth = mDepth;
+
+		UINT32 size = 0;
+		for(UINT32 mip = 0; mip <= mNumMipmaps; mip++)
+		{
+			size += PixelUtil::getMemorySize(width, height, depth, mFormat);
+
+			width = std::max(1U, width / 2);
+			height = std::max(1U, height / 2);
+			depth = std::max(1U, depth / 2);
+		}
+
+		return getNumFaces() * size;
 	}
 
 	UINT32 Texture::getNumFaces() const
@@ -1,19 +1,12 @@
 //__________________________ Banshee Project - A modern game development toolkit _________________________________//
 //_____________________________________ www.banshee-project.com __________________________________________________//
 //________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsCorePrerequisites.h"
 #include "BsUUID.h"
-#include "BsPlatform.h"
-#include <chrono>
-
-using namespace std::chrono;
 
 namespace BansheeEngine
 {
-	UUIDGenerator::UUIDGenerator()
-		:mRandomGenerator((unsigned int)system_clock::now().time_since_epoch().count())
-	{
-		mHaveMacAddress = Platform::getMACAddress(mMACAddress);
-	}
+	const UUID UUID::EMPTY;
 
 	void appendHex(String& str, UINT8 n)
 	{
@@ -37,44 +30,68 @@ namespace BansheeEngine
 	}
 
 
-	String UUIDGenerator::generateRandom()
+	UUID::UUID(const String& uuid)
 	{
-		mSpinLock.lock();
+		memset(mData, 0, sizeof(mData));
 
-		auto timestamp = system_clock::now().time_since_epoch().count();
+		if(uuid.size() != 36)
+			return;
 
-		UINT32 timeLow = UINT32(timestamp & 0xFFFFFFFF);
-		UINT16 timeMid = UINT16((timestamp >> 32) & 0xFFFF);
-		UINT16 timeHiAndVersion = UINT16((timestamp >> 48) & 0x0FFF) + (UUIDV_TimeBased << 12);
-		UINT16 clockSeq = (UINT16(mRandomGenerator() >> 4) & 0x3FFF) | 0x8000;
+		UINT32 data[4] = { 0, 0, 0, 0 };
+		UINT32 numDigits = 0;
+		for(UINT32 i = 0; i < 36; i++)
+		{
+			char c = uuid[i];
+
+			if(i == 8 || i == 13 || i == 18 || i == 23)
+			{
+				if(c != '-')
+					return;
+
+				continue;
+			}
+
+			UINT32 digit;
+			if(c >= '0' && c <= '9')
+				digit = c - '0';
+			else if(c >= 'a' && c <= 'f')
+				digit = c - 'a' + 10;
+			else if(c >= 'A' && c <= 'F')
+				digit = c - 'A' + 10;
+			else
+				return;
+
+			UINT32& word = data[numDigits / 8];
+			word = (word << 4) | digit;
+			numDigits++;
+		}
+
+		memcpy(mData, data, sizeof(mData));
+	}
+
+	String UUID::toString() const
+	{
+		if(empty())
+			return StringUtil::BLANK;
 
 		String result;
 		result.reserve(36);
 
-		appendHex(result, timeLow);
+		appendHex(result, mData[0]);
 		result += '-';
 
-		appendHex(result, timeMid);
+		appendHex(result, UINT16(mData[1] >> 16));
 		result += '-';
 
-		appendHex(result, timeHiAndVersion);
+		appendHex(result, UINT16(mData[1] & 0xFFFF));
 		result += '-';
 
-		appendHex(result, clockSeq);
+		appendHex(result, UINT16(mData[2] >> 16));
 		result += '-';
 
-		if (mHaveMacAddress)
-		{
-			for (int i = 0; i < sizeof(MACAddress); ++i)
-				appendHex(result, mMACAddress.value[i]);
-		}
-		else
-		{
-			for (int i = 0; i < sizeof(MACAddress); ++i)
-				appendHex(result, (UINT8)(mRandomGenerator() % 255));
-		}
+		appendHex(result, UINT16(mData[2] & 0xFFFF));
+		appendHex(result, mData[3]);
 
-		mSpinLock.unlock();
 		return result;
 	}
 };
\ No newline at end of file
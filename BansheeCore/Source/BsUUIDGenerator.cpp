@@ -0,0 +1,51 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsUUIDGenerator.h"
+#include "BsPlatform.h"
+#include <chrono>
+
+using namespace std::chrono;
+
+namespace BansheeEngine
+{
+	UUIDGenerator::UUIDGenerator()
+		:mRandomGenerator((unsigned int)system_clock::now().time_since_epoch().count())
+	{
+		mHaveMacAddress = Platform::getMACAddress(mMACAddress);
+	}
+
+	UUID UUIDGenerator::generateRandom()
+	{
+		mSpinLock.lock();
+
+		auto timestamp = system_clock::now().time_since_epoch().count();
+
+		UINT32 timeLow = UINT32(timestamp & 0xFFFFFFFF);
+		UINT16 timeMid = UINT16((timestamp >> 32) & 0xFFFF);
+		UINT16 timeHiAndVersion = UINT16((timestamp >> 48) & 0x0FFF) + (UUIDV_TimeBased << 12);
+		UINT16 clockSeq = (UINT16(mRandomGenerator() >> 4) & 0x3FFF) | 0x8000;
+
+		UINT8 node[6];
+		if (mHaveMacAddress)
+		{
+			for (int i = 0; i < sizeof(MACAddress); ++i)
+				node[i] = mMACAddress.value[i];
+		}
+		else
+		{
+			for (int i = 0; i < sizeof(MACAddress); ++i)
+				node[i] = (UINT8)(mRandomGenerator() % 255);
+		}
+
+		mSpinLock.unlock();
+
+		UUID result;
+		result.mData[0] = timeLow;
+		result.mData[1] = ((UINT32)timeMid << 16) | timeHiAndVersion;
+		result.mData[2] = ((UINT32)clockSeq << 16) | ((UINT32)node[0] << 8) | node[1];
+		result.mData[3] = ((UINT32)node[2] << 24) | ((UINT32)node[3] << 16) | ((UINT32)node[4] << 8) | node[5];
+
+		return result;
+	}
+};
\ No newline at end of file
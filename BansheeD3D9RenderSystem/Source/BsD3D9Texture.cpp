@@ -268,9 +268,10 @@ namespace BansheeEngine
 	
 	UINT32 D3D9Texture::calculateSize() const
 	{
-		UINT32 instanceSize = getNumFaces() * PixelUtil::getMemorySize(mWidth, mHeight, mDepth, mFormat);
+		UINT32 instanceSize = Texture::calculateSize();
 
-		return instanceSize * (UINT32)mMapDeviceToTextureResources.size();
+		// Device resources may not be created yet, but will be for at least one device
+		return instanceSize * std::max(1U, (UINT32)mMapDeviceToTextureResources.size());
 	}
 	
 	void D3D9Texture::determinePool()
@@ -110,6 +110,7 @@ namespace BansheeEngine
 
 		static const Path DefaultSkinFolder;
 		static const Path DefaultCursorFolder;
+		static const Path DefaultImportCacheFolder;
 
 		static const WString DefaultFontPath;
 		static const UINT32 DefaultFontSize;
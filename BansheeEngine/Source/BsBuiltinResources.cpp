@@ -26,6 +26,7 @@ namespace BansheeEngine
 
 	const Path BuiltinResources::DefaultSkinFolder = L"..\\..\\Data\\Engine\\Skin\\";
 	const Path BuiltinResources::DefaultCursorFolder = L"..\\..\\Data\\Engine\\Cursors\\";
+	const Path BuiltinResources::DefaultImportCacheFolder = L"..\\..\\Data\\Engine\\ImportCache\\";
 
 	const WString BuiltinResources::WhiteTex = L"White.psd";
 
@@ -130,6 +131,10 @@ namespace BansheeEngine
 	BuiltinResources::BuiltinResources()
 	{
 		// TODO - Normally I want to load this from some file
+
+		// Built-in resources are imported on every start-up, so reuse the results of previous imports
+		if(Importer::instance().getImportCacheFolder().isEmpty())
+			Importer::instance().setImportCacheFolder(DefaultImportCacheFolder);
 		
 		mWhiteSpriteTexture = getSkinTexture(WhiteTex);
 
@@ -181,7 +186,6 @@ namespace BansheeEngine
 		gCoreAccessor().submitToCoreThread(true);
 
 		// Label
-		// TODO - Instead of importing font every time, try to save a resource and then just load it?
 		HFont font;
 
 		{
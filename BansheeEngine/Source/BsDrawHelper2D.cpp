@@ -77,7 +77,7 @@ namespace BansheeEngine
 		DebugDrawCommand& dbgCmd = commands.back();
 		dbgCmd.endTime = gTime().getTime() + timeout;
 
-		MeshDataPtr meshData = bs_shared_ptr<MeshData, ScratchAlloc>(4, 6, mVertexDesc);
+		MeshDataPtr meshData = bs_shared_ptr<MeshData, PoolAlloc>(4, 6, mVertexDesc);
 
 		RectF actualArea = area;
 		if(coordType == DebugDrawCoordType::Normalized)
@@ -127,7 +127,7 @@ namespace BansheeEngine
 		DebugDrawCommand& dbgCmd = commands.back();
 		dbgCmd.endTime = gTime().getTime() + timeout;
 
-		MeshDataPtr meshData = bs_shared_ptr<MeshData, ScratchAlloc>(2, 2, mVertexDesc);
+		MeshDataPtr meshData = bs_shared_ptr<MeshData, PoolAlloc>(2, 2, mVertexDesc);
 
 		Vector2 actualA = a;
 		Vector2 actualB = b;
@@ -166,7 +166,7 @@ namespace BansheeEngine
 		DebugDrawCommand& dbgCmd = commands.back();
 		dbgCmd.endTime = gTime().getTime() + timeout;
 
-		MeshDataPtr meshData = bs_shared_ptr<MeshData, ScratchAlloc>(8, 30, mVertexDesc);
+		MeshDataPtr meshData = bs_shared_ptr<MeshData, PoolAlloc>(8, 30, mVertexDesc);
 
 		Vector2 actualA = a;
 		Vector2 actualB = b;
@@ -206,7 +206,7 @@ namespace BansheeEngine
 		DebugDrawCommand& dbgCmd = commands.back();
 		dbgCmd.endTime = gTime().getTime() + timeout;
 
-		MeshDataPtr meshData = bs_shared_ptr<MeshData, ScratchAlloc>(
+		MeshDataPtr meshData = bs_shared_ptr<MeshData, PoolAlloc>(
 			(UINT32)(linePoints.size() * 2), (UINT32)(linePoints.size() * 2), mVertexDesc);
 
 		if(coordType == DebugDrawCoordType::Normalized)
@@ -251,7 +251,7 @@ namespace BansheeEngine
 		DebugDrawCommand& dbgCmd = commands.back();
 		dbgCmd.endTime = gTime().getTime() + timeout;
 
-		MeshDataPtr meshData = bs_shared_ptr<MeshData, ScratchAlloc>((UINT32)(linePoints.size() * 4), (UINT32)(linePoints.size() * 15), mVertexDesc);
+		MeshDataPtr meshData = bs_shared_ptr<MeshData, PoolAlloc>((UINT32)(linePoints.size() * 4), (UINT32)(linePoints.size() * 15), mVertexDesc);
 
 		if(coordType == DebugDrawCoordType::Normalized)
 		{
@@ -69,7 +69,7 @@ namespace BansheeEngine
 		DebugDrawCommand& dbgCmd = commands.back();
 		dbgCmd.endTime = gTime().getTime() + timeout;
 
-		MeshDataPtr meshData = bs_shared_ptr<MeshData, ScratchAlloc>(2, 2, mVertexDesc);
+		MeshDataPtr meshData = bs_shared_ptr<MeshData, PoolAlloc>(2, 2, mVertexDesc);
 
 		line_Pixel(a, b, color, meshData, 0, 0);
 
@@ -93,7 +93,7 @@ namespace BansheeEngine
 		DebugDrawCommand& dbgCmd = commands.back();
 		dbgCmd.endTime = gTime().getTime() + timeout;
 
-		MeshDataPtr meshData = bs_shared_ptr<MeshData, ScratchAlloc>(8, 30, mVertexDesc);
+		MeshDataPtr meshData = bs_shared_ptr<MeshData, PoolAlloc>(8, 30, mVertexDesc);
 
 		line_AA(a, b, width, borderWidth, color, meshData, 0, 0);
 
@@ -117,7 +117,7 @@ namespace BansheeEngine
 		DebugDrawCommand& dbgCmd = commands.back();
 		dbgCmd.endTime = gTime().getTime() + timeout;
 
-		MeshDataPtr meshData = bs_shared_ptr<MeshData, ScratchAlloc>(
+		MeshDataPtr meshData = bs_shared_ptr<MeshData, PoolAlloc>(
 			(UINT32)(linePoints.size() * 2), (UINT32)(linePoints.size() * 2), mVertexDesc);
 
 		lineList_Pixel(linePoints, color, meshData, 0, 0);
@@ -143,7 +143,7 @@ namespace BansheeEngine
 		DebugDrawCommand& dbgCmd = commands.back();
 		dbgCmd.endTime = gTime().getTime() + timeout;
 
-		MeshDataPtr meshData = bs_shared_ptr<MeshData, ScratchAlloc>((UINT32)(linePoints.size() * 4), (UINT32)(linePoints.size() * 15), mVertexDesc);
+		MeshDataPtr meshData = bs_shared_ptr<MeshData, PoolAlloc>((UINT32)(linePoints.size() * 4), (UINT32)(linePoints.size() * 15), mVertexDesc);
 
 		lineList_AA(linePoints, width, borderWidth, color, meshData, 0, 0);	
 
@@ -167,7 +167,7 @@ namespace BansheeEngine
 		DebugDrawCommand& dbgCmd = commands.back();
 		dbgCmd.endTime = gTime().getTime() + timeout;
 
-		MeshDataPtr meshData = bs_shared_ptr<MeshData, ScratchAlloc>(8, 36, mVertexDesc);
+		MeshDataPtr meshData = bs_shared_ptr<MeshData, PoolAlloc>(8, 36, mVertexDesc);
 
 		aabox(box, meshData, 0, 0);	
 
@@ -34,9 +34,9 @@ namespace BansheeEngine
 			mNumQuads += textData.getNumQuadsForPage(i);
 
 		if(mQuads != nullptr)
-			bs_delete<ScratchAlloc>(mQuads);
+			bs_delete<GenAlloc>(mQuads);
 
-		mQuads = bs_newN<Vector2, ScratchAlloc>(mNumQuads * 4);
+		mQuads = bs_newN<Vector2, GenAlloc>(mNumQuads * 4);
 
 		TextSprite::genTextQuads(textData, mTextDesc.width, mTextDesc.height, mTextDesc.horzAlign, mTextDesc.vertAlign, mTextDesc.anchor, 
 			mQuads, nullptr, nullptr, mNumQuads);
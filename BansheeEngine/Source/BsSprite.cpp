@@ -252,13 +252,13 @@ namespace BansheeEngine
 			UINT32 indexCount = renderElem.numQuads * 6;
 
 			if(renderElem.vertices != nullptr)
-				bs_deleteN<ScratchAlloc>(renderElem.vertices, vertexCount);
+				bs_deleteN<GenAlloc>(renderElem.vertices, vertexCount);
 
 			if(renderElem.uvs != nullptr)
-				bs_deleteN<ScratchAlloc>(renderElem.uvs, vertexCount);
+				bs_deleteN<GenAlloc>(renderElem.uvs, vertexCount);
 
 			if(renderElem.indexes != nullptr)
-				bs_deleteN<ScratchAlloc>(renderElem.indexes, indexCount);
+				bs_deleteN<GenAlloc>(renderElem.indexes, indexCount);
 
 			if(renderElem.matInfo.material != nullptr)
 			{
@@ -196,7 +196,7 @@ namespace BansheeEngine
 		if (!mesh->GetNode())
 		{
 			VertexDataDescPtr tmpVertDesc = bs_shared_ptr<VertexDataDesc>();
-			return bs_shared_ptr<MeshData, ScratchAlloc>(0, 0, tmpVertDesc);
+			return bs_shared_ptr<MeshData, PoolAlloc>(0, 0, tmpVertDesc);
 		}
 
 		// Find out which vertex attributes exist
@@ -385,7 +385,7 @@ namespace BansheeEngine
 		}
 
 		// Allocate the array memory for all vertices and indices
-		MeshDataPtr meshData = bs_shared_ptr<MeshData, ScratchAlloc>(vertexCount, numIndices, vertexDesc);
+		MeshDataPtr meshData = bs_shared_ptr<MeshData, PoolAlloc>(vertexCount, numIndices, vertexDesc);
 
 		VertexElemIter<Vector3> positions = meshData->getVec3DataIter(VES_POSITION);
 
@@ -49,7 +49,7 @@ namespace BansheeEngine
 
 	ImportOptionsPtr FontImporter::createImportOptions() const
 	{
-		return bs_shared_ptr<FontImportOptions, ScratchAlloc>();
+		return bs_shared_ptr<FontImportOptions, PoolAlloc>();
 	}
 
 	ResourcePtr FontImporter::import(const Path& filePath, ConstImportOptionsPtr importOptions)
@@ -125,7 +125,7 @@ namespace BansheeEngine
 
 	ImportOptionsPtr FreeImgImporter::createImportOptions() const
 	{
-		return bs_shared_ptr<TextureImportOptions, ScratchAlloc>();
+		return bs_shared_ptr<TextureImportOptions, PoolAlloc>();
 	}
 
 	ResourcePtr FreeImgImporter::import(const Path& filePath, ConstImportOptionsPtr importOptions)
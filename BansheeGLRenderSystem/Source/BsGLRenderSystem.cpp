@@ -248,6 +248,8 @@ namespace BansheeEngine
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
+		ScratchScope scratchScope;
+
 		bindableParams->updateHardwareBuffers();
 		const GpuParamDesc& paramDesc = bindableParams->getParamDesc();
 		GLSLGpuProgramPtr activeProgram = getActiveProgram(gptype);
@@ -154,7 +154,7 @@ namespace BansheeEngine
 			GetMonitorInfo(hMonitor, &monitorInfoEx);
 
 			size_t devNameLen = strlen(monitorInfoEx.szDevice);
-			mDeviceName = (char*)bs_alloc<ScratchAlloc>((UINT32)(devNameLen + 1));
+			mDeviceName = (char*)bs_alloc<GenAlloc>((UINT32)(devNameLen + 1));
 
 			strcpy_s(mDeviceName, devNameLen + 1, monitorInfoEx.szDevice);
 
@@ -360,7 +360,7 @@ namespace BansheeEngine
 
 		if (mDeviceName != NULL)
 		{
-			bs_free<ScratchAlloc>(mDeviceName);
+			bs_free<GenAlloc>(mDeviceName);
 			mDeviceName = NULL;
 		}
 
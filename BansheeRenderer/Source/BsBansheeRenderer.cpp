@@ -201,13 +201,15 @@ namespace BansheeEngine
 
 	void BansheeRenderer::renderAll() 
 	{
+		BS_MEMORY_TAG("Renderer");
+
 		gBsSceneManager().updateRenderableTransforms();
 
 		// Remove proxies from deleted Renderables
 		for (auto& proxy : mDeletedRenderableProxies)
 		{
 			if (proxy != nullptr)
-				gCoreAccessor().queueCommand(std::bind(&BansheeRenderer::removeRenderableProxy, this, proxy));
+				gCoreAccessor().queueFrameCommand(std::bind(&BansheeRenderer::removeRenderableProxy, this, proxy));
 		}
 
 		// Add or update Renderable proxies
@@ -223,12 +225,12 @@ namespace BansheeEngine
 			if (renderable->_isCoreDirty())
 			{
 				if (proxy != nullptr)
-					gCoreAccessor().queueCommand(std::bind(&BansheeRenderer::removeRenderableProxy, this, proxy));
+					gCoreAccessor().queueFrameCommand(std::bind(&BansheeRenderer::removeRenderableProxy, this, proxy));
 
 				proxy = renderable->_createProxy();
 				renderable->_setActiveProxy(proxy);
 
-				gCoreAccessor().queueCommand(std::bind(&BansheeRenderer::addRenderableProxy, this, proxy));
+				gCoreAccessor().queueFrameCommand(std::bind(&BansheeRenderer::addRenderableProxy, this, proxy));
 
 				dirtyRenderables.push_back(renderable);
 				dirtySceneObjects.push_back(renderable->SO());
@@ -238,7 +240,7 @@ namespace BansheeEngine
 			{
 				assert(proxy != nullptr);
 
-				gCoreAccessor().queueCommand(std::bind(&BansheeRenderer::updateRenderableProxy, this, proxy, renderable->SO()->getWorldTfrm()));
+				gCoreAccessor().queueFrameCommand(std::bind(&BansheeRenderer::updateRenderableProxy, this, proxy, renderable->SO()->getWorldTfrm()));
 
 				dirtySceneObjects.push_back(renderable->SO());
 			}
@@ -250,7 +252,7 @@ namespace BansheeEngine
 					HMaterial mat = renderable->getMaterial(i);
 					if (mat != nullptr && mat.isLoaded() && mat->_isCoreDirty(MaterialDirtyFlag::Params))
 					{
-						gCoreAccessor().queueCommand(std::bind(&BansheeRenderer::updateMaterialProxy, this, proxy->renderableElements[i]->material, mat->_getDirtyProxyParams()));
+						gCoreAccessor().queueFrameCommand(std::bind(&BansheeRenderer::updateMaterialProxy, this, proxy->renderableElements[i]->material, mat->_getDirtyProxyParams()));
 						mat->_markCoreClean(MaterialDirtyFlag::Params);
 					}
 				}
@@ -269,7 +271,7 @@ namespace BansheeEngine
 		for (auto& proxy : mDeletedCameraProxies)
 		{
 			if (proxy != nullptr)
-				gCoreAccessor().queueCommand(std::bind(&BansheeRenderer::removeCameraProxy, this, proxy));
+				gCoreAccessor().queueFrameCommand(std::bind(&BansheeRenderer::removeCameraProxy, this, proxy));
 		}
 
 		// Add or update Camera proxies
@@ -281,12 +283,12 @@ namespace BansheeEngine
 				CameraProxyPtr proxy = camera->_getActiveProxy();
 
 				if (proxy != nullptr)
-					gCoreAccessor().queueCommand(std::bind(&BansheeRenderer::removeCameraProxy, this, proxy));
+					gCoreAccessor().queueFrameCommand(std::bind(&BansheeRenderer::removeCameraProxy, this, proxy));
 
 				proxy = camera->_createProxy();
 				camera->_setActiveProxy(proxy);
 
-				gCoreAccessor().queueCommand(std::bind(&BansheeRenderer::addCameraProxy, this, proxy));
+				gCoreAccessor().queueFrameCommand(std::bind(&BansheeRenderer::addCameraProxy, this, proxy));
 
 				camera->_markCoreClean();
 				dirtySceneObjects.push_back(camera->SO());
@@ -296,7 +298,7 @@ namespace BansheeEngine
 				CameraProxyPtr proxy = camera->_getActiveProxy();
 				assert(proxy != nullptr);
 
-				gCoreAccessor().queueCommand(std::bind(&BansheeRenderer::updateCameraProxy, this, 
+				gCoreAccessor().queueFrameCommand(std::bind(&BansheeRenderer::updateCameraProxy, this, 
 					proxy, camera->SO()->getWorldPosition(), camera->SO()->getWorldTfrm(), camera->getViewMatrix()));
 
 				dirtySceneObjects.push_back(camera->SO());
@@ -354,10 +356,10 @@ namespace BansheeEngine
 				renderQueue->add(materialProxy, meshProxy, distanceToCamera);
 			}
 
-			gCoreAccessor().queueCommand(std::bind(&BansheeRenderer::addToRenderQueue, this, camera->_getActiveProxy(), renderQueue));
+			gCoreAccessor().queueFrameCommand(std::bind(&BansheeRenderer::addToRenderQueue, this, camera->_getActiveProxy(), renderQueue));
 		}
 
-		gCoreAccessor().queueCommand(std::bind(&BansheeRenderer::renderAllCore, this, gTime().getTime()));
+		gCoreAccessor().queueFrameCommand(std::bind(&BansheeRenderer::renderAllCore, this, gTime().getTime()));
 	}
 
 	void BansheeRenderer::addToRenderQueue(CameraProxyPtr proxy, RenderQueuePtr renderQueue)
@@ -16,8 +16,6 @@ namespace BansheeEngine
 
 	// TODO - Low priority. I will probably want to extract a generalized Serializer class so we can re-use the code
 	// in text or other serializers
-	// TODO - Low priority. Encode does a chunk-based encode so that we don't need to know the buffer size in advance,
-	// and don't have to use a lot of memory for the buffer. Consider doing something similar for decode.
 	// TODO - Low priority. Add a simple encode method that doesn't require a callback, instead it calls the callback internally
 	// and creates the buffer internally.
 	/**
@@ -54,10 +52,20 @@ namespace BansheeEngine
 		 * @param	flushBufferCallback 	This callback will get called whenever the buffer gets full (Be careful to check the provided
 		 * 									"bytesRead" variable, as buffer might not be full completely). User must then
 		 * 									either create a new buffer or empty the existing one, and then return it by the callback.
-		 * 									If the returned buffer address is NULL, encoding is aborted.
+		 * 									If the returned buffer address is NULL, encoding is aborted. The callback is called
+		 * 									one final time once encoding is done, with "newBufferSize" set to zero, in which
+		 * 									case no more space needs to be provided.
+		 * @param	parallel				(optional) If true, objects are encoded in parallel using the TaskScheduler.
+		 * 									Encoded data is identical to the data encoded serially, although the callback
+		 * 									might be triggered at different points. RTTI types of all encoded objects must
+		 * 									support serializing different objects on multiple threads at once.
+		 * @param	context					(optional) Context passed to RTTI serialization callbacks of all encoded objects.
+		 * 									Use it instead of global or thread local state, as RTTI callbacks might be
+		 * 									called from different threads when encoding in parallel.
 		 */
 		void encode(IReflectable* object, UINT8* buffer, UINT32 bufferLength, int* bytesWritten, 
-			std::function<UINT8*(UINT8* buffer, int bytesWritten, UINT32& newBufferSize)> flushBufferCallback);
+			std::function<UINT8*(UINT8* buffer, int bytesWritten, UINT32& newBufferSize)> flushBufferCallback, bool parallel = false,
+			SerializationContext* context = nullptr);
 
 		/**
 		 * @brief	Decodes an object from binary data.
@@ -67,7 +75,36 @@ namespace BansheeEngine
 		 */
 		std::shared_ptr<IReflectable> decode(UINT8* data, UINT32 dataLength);
 
+		/**
+		 * @brief	Decodes an object from binary data read from a stream. Data is read in chunks
+		 * 			through a window of limited size, so the encoded data never needs to be
+		 * 			fully loaded in memory.
+		 *
+		 * @param 	stream  	Stream to read the data from, starting at its current position.
+		 * @param	dataLength	Length of the data, in bytes.
+		 */
+		std::shared_ptr<IReflectable> decode(const DataStreamPtr& stream, UINT64 dataLength);
+
+		/**
+		 * @brief	Decodes an object from binary data owned by another object (e.g. a memory mapped file).
+		 * 			Data blocks of fields flagged with RTTI_Flag_DataBlockView will reference the data
+		 * 			in place instead of copying it, and keep a reference to the owner.
+		 *
+		 * @param 	data  		Binary data to decode.
+		 * @param	dataLength	Length of the data, in bytes.
+		 * @param	dataOwner	Object that owns the data.
+		 */
+		std::shared_ptr<IReflectable> decode(UINT8* data, UINT64 dataLength, const std::shared_ptr<void>& dataOwner);
+
+		/**
+		 * @brief	Alignment of data blocks flagged with RTTI_Flag_DataBlockView in the encoded data, in bytes.
+		 * 			Alignment is relative to the start of the encoded data.
+		 */
+		static const UINT32 DATA_BLOCK_ALIGNMENT = 16;
+
 	private:
+		class DecodeSource;
+
 		struct ObjectToEncode
 		{
 			ObjectToEncode(UINT32 _objectId, std::shared_ptr<IReflectable> _object)
@@ -80,14 +117,13 @@ namespace BansheeEngine
 
 		struct ObjectToDecode
 		{
-			ObjectToDecode(UINT32 _objectId, std::shared_ptr<IReflectable> _object, UINT8* _locationInBuffer, UINT32 _locationInFile)
-				:objectId(_objectId), object(_object), locationInBuffer(_locationInBuffer), locationInFile(_locationInFile), isDecoded(false)
+			ObjectToDecode(UINT32 _objectId, std::shared_ptr<IReflectable> _object, UINT64 _locationInFile)
+				:objectId(_objectId), object(_object), locationInFile(_locationInFile), isDecoded(false)
 			{ }
 
 			UINT32 objectId;
 			std::shared_ptr<IReflectable> object;
-			UINT8* locationInBuffer;
-			UINT32 locationInFile;
+			UINT64 locationInFile;
 			bool isDecoded;
 		};
 
@@ -97,10 +133,54 @@ namespace BansheeEngine
 			UINT32 typeId;
 		};
 
+		/**
+		 * @brief	Reference to another object in data of an object encoded in parallel. Identifier of
+		 * 			the referenced object is assigned once the encoding ends.
+		 */
+		struct DeferredReference
+		{
+			DeferredReference(UINT32 _offset, std::shared_ptr<IReflectable> _object)
+				:offset(_offset), object(_object)
+			{ }
+
+			UINT32 offset;
+			std::shared_ptr<IReflectable> object;
+		};
+
+		/**
+		 * @brief	Aligned data block in data of an object encoded in parallel. Its padding needs to 
+		 * 			be adjusted once the location of the object in the output is known.
+		 */
+		struct AlignedDataBlock
+		{
+			AlignedDataBlock(UINT32 _metaOffset, UINT32 _padding)
+				:metaOffset(_metaOffset), padding(_padding)
+			{ }
+
+			UINT32 metaOffset;
+			UINT32 padding;
+		};
+
+		/**
+		 * @brief	Data of a single object encoded in parallel.
+		 */
+		struct EncodedObject
+		{
+			Vector<UINT8> data;
+			Vector<DeferredReference> references;
+			Vector<AlignedDataBlock> alignedDataBlocks;
+			std::exception_ptr error;
+		};
+
 		UnorderedMap<void*, UINT32> mObjectAddrToId;
 		UINT32 mLastUsedObjectId;
 		Vector<ObjectToEncode> mObjectsToEncode;
 		int mTotalBytesWritten;
+		SerializationContext* mContext;
+
+		bool mDeferReferences;
+		Vector<DeferredReference> mDeferredReferences;
+		Vector<AlignedDataBlock> mAlignedDataBlocks;
 
 		Map<UINT32, ObjectToDecode> mObjectMap;
 
@@ -116,10 +196,48 @@ namespace BansheeEngine
 		UINT8* encodeInternal(IReflectable* object, UINT32 objectId, UINT8* buffer, UINT32& bufferLength, int* bytesWritten, 
 			std::function<UINT8*(UINT8* buffer, int bytesWritten, UINT32& newBufferSize)> flushBufferCallback);
 
+		/**
+		 * @brief	Encodes the provided object and all the objects it references, encoding multiple objects 
+		 * 			in parallel.
+		 */
+		UINT8* encodeParallel(IReflectable* object, UINT8* buffer, UINT32& bufferLength, int* bytesWritten, 
+			std::function<UINT8*(UINT8* buffer, int bytesWritten, UINT32& newBufferSize)> flushBufferCallback);
+
+		/**
+		 * @brief	Encodes a single IReflectable object into its own buffer, leaving references to other 
+		 * 			objects unassigned. Safe to call from multiple threads at once, for different objects.
+		 */
+		static void encodeDeferred(IReflectable* object, UINT32 objectId, SerializationContext* context, EncodedObject& output);
+
+		/**
+		 * @brief	Writes data of an object encoded using encodeDeferred to the output, after its references
+		 * 			have been assigned.
+		 */
+		UINT8* writeEncodedObject(const EncodedObject& encodedObject, UINT8* buffer, UINT32& bufferLength, int* bytesWritten, 
+			std::function<UINT8*(UINT8* buffer, int bytesWritten, UINT32& newBufferSize)> flushBufferCallback);
+
+		/**
+		 * @brief	Copies an arbitrary amount of data to the output, flushing the buffer as many times as needed.
+		 */
+		UINT8* copyToBuffer(const UINT8* data, UINT32 size, UINT8* buffer, UINT32& bufferLength, int* bytesWritten, 
+			std::function<UINT8*(UINT8* buffer, int bytesWritten, UINT32& newBufferSize)> flushBufferCallback);
+
+		/**
+		 * @brief	Decodes the root object, and all the objects it references, from the provided source.
+		 */
+		std::shared_ptr<IReflectable> decodeObjects(DecodeSource& source);
+
 		/**
 		 * @brief	Decodes a single IReflectable object.
+		 *
+		 * @param	object				Object to decode the fields into. If null the data is only parsed.
+		 * @param	source				Source to read the encoded data from.
+		 * @param	dataLength			Offset at which the encoded data ends.
+		 * @param [in,out]	bytesRead	Offset at which to start decoding. Advanced past the decoded data.
+		 *
+		 * @return	True if there are more objects following the decoded one.
 		 */
-		bool decodeInternal(std::shared_ptr<IReflectable> object, UINT8* data, UINT32 dataLength, UINT32& bytesRead);
+		bool decodeInternal(const std::shared_ptr<IReflectable>& object, DecodeSource& source, UINT64 dataLength, UINT64& bytesRead);
 
 		/**
 		* @brief	Encodes data required for representing a serialized field, into 4 bytes.
@@ -161,7 +279,7 @@ namespace BansheeEngine
 		/**
 		 * @brief	Helper method for decoding a complex object from the provided data buffer.
 		 */
-		std::shared_ptr<IReflectable> complexTypeFromBuffer(RTTIReflectableFieldBase* field, UINT8* data, int* complexTypeSize);
+		std::shared_ptr<IReflectable> complexTypeFromBuffer(RTTIReflectableFieldBase* field, DecodeSource& source, UINT64 offset, int* complexTypeSize);
 
 		/**
 		 * @brief	Finds an existing, or creates a unique unique identifier for the specified object. 
@@ -172,7 +290,11 @@ namespace BansheeEngine
 		 * @brief	Finds or creates an id for the provided object and returns it.
 		 * 			And it adds the object to a list of objects that need to be encoded,
 		 * 			if it's not already there.
+		 *
+		 * @param	object	Object to register.
+		 * @param	offset	Location in the output at which the returned id will be written. Only used 
+		 * 					when encoding in parallel, in which case the id is assigned later.
 		 */
-		UINT32 registerObjectPtr(std::shared_ptr<IReflectable> object);
+		UINT32 registerObjectPtr(std::shared_ptr<IReflectable> object, UINT32 offset);
 	};
 }
\ No newline at end of file
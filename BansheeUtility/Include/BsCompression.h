@@ -0,0 +1,52 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Fast LZ77 based compression of independent blocks of data. Favors decompression 
+	 * 			speed over compression ratio.
+	 *
+	 * @note	Compressed data is a sequence of literal runs followed by back-references within
+	 * 			the same block, using the same layout as the LZ4 block format.
+	 *
+	 *			Thread safe.
+	 */
+	class BS_UTILITY_EXPORT Compression
+	{
+	public:
+		/**
+		 * @brief	Returns the size of the buffer that is always large enough to hold the compressed
+		 * 			data, for input of the provided size.
+		 */
+		static UINT32 getMaxCompressedSize(UINT32 size);
+
+		/**
+		 * @brief	Compresses a block of data.
+		 *
+		 * @param	input			Data to compress.
+		 * @param	inputSize		Size of the data to compress, in bytes.
+		 * @param [out]	output		Buffer to write the compressed data to.
+		 * @param	outputCapacity	Size of the output buffer, in bytes.
+		 *
+		 * @return	Size of the compressed data in bytes, or 0 if it doesn't fit in the output buffer.
+		 */
+		static UINT32 compress(const UINT8* input, UINT32 inputSize, UINT8* output, UINT32 outputCapacity);
+
+		/**
+		 * @brief	Decompresses a block of data compressed with "compress".
+		 *
+		 * @param	input			Compressed data.
+		 * @param	inputSize		Size of the compressed data, in bytes.
+		 * @param [out]	output		Buffer to write the decompressed data to.
+		 * @param	outputSize		Size of the data before it was compressed, in bytes.
+		 *
+		 * @return	True if the data was successfully decompressed, false if the compressed data is malformed.
+		 */
+		static bool decompress(const UINT8* input, UINT32 inputSize, UINT8* output, UINT32 outputSize);
+	};
+}
\ No newline at end of file
@@ -22,30 +22,187 @@ namespace BansheeEngine
 		/**
 		 * @brief	Parses the provided object, serializes all of its data as specified by its
 		 *			RTTIType and saves the serialized data to the provided file location.
+		 *
+		 * @param	object			Object to serialize.
+		 * @param	fileLocation	Location of the file to save the data to.
+		 * @param	compress		(optional) If true, serialized data is split into blocks which are
+		 *							compressed independently, allowing them to be decompressed in parallel.
+		 * @param	metaData		(optional) Additional object to store in the file, that can be read separately
+		 *							from the main object using decodeMetaData. It is always stored uncompressed.
+		 * @param	parallel		(optional) If true, objects are encoded in parallel using the TaskScheduler. 
+		 *							See BinarySerializer::encode.
+		 * @param	context			(optional) Context passed to RTTI serialization callbacks of the main object, and 
+		 *							all objects it references.
+		 *
+		 * @note	Meta data is encoded after the main object, so it may be filled out while the main object is
+		 *			being encoded (e.g. from RTTI serialization callbacks).
 		 */
-		void encode(IReflectable* object, const Path& fileLocation);
+		void encode(IReflectable* object, const Path& fileLocation, bool compress = false, IReflectable* metaData = nullptr, 
+			bool parallel = false, SerializationContext* context = nullptr);
 
 		/**
 		 * @brief	Deserializes an IReflectable object by reading the binary data at
 		 *			the provided file location.
+		 *
+		 * @note	Compressed files are detected automatically, and their blocks decompressed in parallel
+		 *			using the TaskScheduler. Blocks are decompressed in batches as decoding progresses, so neither
+		 *			the compressed nor the decompressed file contents ever need to be fully loaded in memory.
 		 */
 		std::shared_ptr<IReflectable> decode(const Path& fileLocation);
 
+		/**
+		 * @brief	Deserializes an IReflectable object from a stream containing contents of a file written by
+		 *			encode. Allows the file to be opened once and read by both this and decodeMetaData.
+		 *
+		 * @note	Stream is read from the beginning, and is left open.
+		 */
+		std::shared_ptr<IReflectable> decode(const DataStreamPtr& stream);
+
+		/**
+		 * @brief	Deserializes an IReflectable object by memory mapping the file at the provided location.
+		 *			Data blocks of fields flagged with RTTI_Flag_DataBlockView reference the mapped memory
+		 *			directly instead of being copied, and keep the mapping alive for as long as they are used.
+		 *
+		 * @note	Data of compressed files is always copied, as it needs to be decompressed.
+		 */
+		std::shared_ptr<IReflectable> decodeMapped(const Path& fileLocation);
+
+		/**
+		 * @brief	Deserializes the meta data object stored in the file at the provided location, without reading
+		 *			the main object. Returns null if the file has no meta data.
+		 */
+		std::shared_ptr<IReflectable> decodeMetaData(const Path& fileLocation);
+
+		/**
+		 * @brief	Deserializes the meta data object from a stream containing contents of a file written by encode,
+		 *			without reading the main object. Returns null if the file has no meta data.
+		 *
+		 * @note	Stream is left open.
+		 */
+		std::shared_ptr<IReflectable> decodeMetaData(const DataStreamPtr& stream);
+
+		/**
+		 * @brief	Deserializes an IReflectable object from contents of a file that were already loaded
+		 *			in memory (e.g. as a part of a larger file).
+		 *
+		 * @param	data		Contents of a file written by encode.
+		 * @param	dataLength	Size of the file contents, in bytes.
+		 * @param	dataOwner	(optional) Object that keeps "data" alive. If provided, data blocks of fields flagged with
+		 *						RTTI_Flag_DataBlockView reference "data" directly instead of being copied, and
+		 *						keep the owner alive for as long as they are used. "data" must be aligned to 
+		 *						BinarySerializer::DATA_BLOCK_ALIGNMENT.
+		 */
+		std::shared_ptr<IReflectable> decode(UINT8* data, UINT64 dataLength, const std::shared_ptr<void>& dataOwner = nullptr);
+
+		/**
+		 * @brief	Deserializes the meta data object from contents of a file that were already loaded in memory.
+		 *			Returns null if the file has no meta data.
+		 */
+		std::shared_ptr<IReflectable> decodeMetaData(UINT8* data, UINT64 dataLength);
+
+		/**
+		 * @brief	Locates the serialized meta data object within contents of a file written by encode. The main 
+		 *			object occupies all the data before the meta data. Returns false if the file has no meta data.
+		 *
+		 * @param	data			Contents of the file.
+		 * @param	dataLength		Size of the file contents, in bytes.
+		 * @param	offset			Output offset of the meta data from the start of the file, in bytes.
+		 * @param	size			Output size of the meta data, in bytes. Meta data can be deserialized from
+		 *							it using BinarySerializer.
+		 */
+		static bool findMetaData(const UINT8* data, UINT64 dataLength, UINT64& offset, UINT32& size);
+
 	private:
+		class DecompressedDataStream;
+
+		/**
+		 * @brief	Placed at the end of a file that contains meta data. Meta data is stored after the main
+		 *			object so the main object always starts at the beginning of the file.
+		 */
+		struct MetaDataFooter
+		{
+			UINT64 offset;
+			UINT32 size;
+			UINT32 magic;
+		};
+
+		/**
+		 * @brief	Header of a compressed file.
+		 */
+		struct CompressedHeader
+		{
+			UINT32 magic;
+			UINT32 version;
+			UINT32 numBlocks;
+			UINT32 blockSize;
+			UINT64 uncompressedSize;
+			UINT64 blockTableOffset;
+		};
+
+		/**
+		 * @brief	Describes a single block of a compressed file. Blocks whose compressed size is
+		 * 			equal to their uncompressed size are stored uncompressed.
+		 */
+		struct CompressedBlock
+		{
+			UINT32 compressedSize;
+			UINT32 uncompressedSize;
+		};
+
 		std::ofstream mOutputStream;
 		UINT8* mWriteBuffer;
 
-		std::ifstream mInputStream;
+		UINT8* mCompressionBuffer;
+		Vector<CompressedBlock> mCompressedBlocks;
+		UINT64 mUncompressedSize;
 
 		/**
 		 * @brief	Called by the binary serializer whenever the buffer gets full.
 		 */
 		UINT8* flushBuffer(UINT8* bufferStart, int bytesWritten, UINT32& newBufferSize);
 
+		/**
+		 * @brief	Called by the binary serializer whenever the buffer gets full, when encoding a compressed file.
+		 * 			Compresses the buffer contents as a single block and writes it to the file.
+		 */
+		UINT8* flushCompressedBuffer(UINT8* bufferStart, int bytesWritten, UINT32& newBufferSize);
+
+		/**
+		 * @brief	Checks if the provided data starts with a compressed file header.
+		 */
+		static bool isCompressed(const UINT8* data, UINT64 dataLength);
+
+		/**
+		 * @brief	Deserializes an IReflectable object from the decompressed contents of a compressed file.
+		 */
+		std::shared_ptr<IReflectable> decodeCompressed(const std::shared_ptr<DecompressedDataStream>& stream);
+
+		/**
+		 * @brief	Reads the meta data footer from the end of the provided stream. Returns false if the
+		 *			stream doesn't end with a valid footer.
+		 */
+		static bool readMetaDataFooter(const DataStreamPtr& stream, MetaDataFooter& footer);
+
+		/**
+		 * @brief	Reads the meta data footer from the end of the provided data. Returns false if the
+		 *			data doesn't end with a valid footer.
+		 */
+		static bool readMetaDataFooter(const UINT8* data, UINT64 dataLength, MetaDataFooter& footer);
+
+		/**
+		 * @brief	Checks if the footer belongs to a file of the provided size.
+		 */
+		static bool isValidMetaDataFooter(const MetaDataFooter& footer, UINT64 fileSize);
+
 		/************************************************************************/
 		/* 								CONSTANTS	                     		*/
 		/************************************************************************/
 	private:
 		static const UINT32 WRITE_BUFFER_SIZE = 2048;
+		static const UINT32 COMPRESSION_BLOCK_SIZE = 256 * 1024;
+		static const UINT32 DECOMPRESSION_BATCH_SIZE = 16; // Number of blocks decompressed in parallel at once
+		static const UINT32 COMPRESSED_MAGIC = 0x43535342; // "BSSC". Lowest bit is never set in serialized object meta data.
+		static const UINT32 COMPRESSED_VERSION = 1;
+		static const UINT32 META_DATA_MAGIC = 0x4D535342; // "BSSM"
 	};
 }
\ No newline at end of file
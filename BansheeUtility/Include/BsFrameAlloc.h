@@ -23,7 +23,7 @@ namespace BansheeEngine
 			MemBlock(UINT32 size);
 			~MemBlock();
 
-			UINT8* alloc(UINT8 amount);
+			UINT8* alloc(UINT32 amount);
 			void clear();
 
 			UINT8* mData;
@@ -44,6 +44,16 @@ namespace BansheeEngine
 		 */
 		UINT8* alloc(UINT32 amount);
 
+		/**
+		 * @brief	Allocates a new block of memory of the specified size, aligned to the specified boundary.
+		 *
+		 * @param	amount		Amount of memory to allocate, in bytes.
+		 * @param	alignment	Alignment of the returned memory, in bytes. Must be a power of two.
+		 * 					
+		 * @note	Not thread safe.
+		 */
+		UINT8* alloc(UINT32 amount, UINT32 alignment);
+
 		/**
 		 * @brief	Deallocates a previously allocated block of memory.
 		 *
@@ -105,11 +115,13 @@ namespace BansheeEngine
 			:mFrameAlloc(frameAlloc)
 		{ }
 
-		StdFrameAlloc(const StdFrameAlloc&) throw()
+		StdFrameAlloc(const StdFrameAlloc& other) throw()
+			:mFrameAlloc(other.mFrameAlloc)
 		{ }
 
 		template <class U>
-		StdFrameAlloc(const StdFrameAlloc<U>&) throw()
+		StdFrameAlloc(const StdFrameAlloc<U>& other) throw()
+			:mFrameAlloc(other.mFrameAlloc)
 		{ }
 
 		~StdFrameAlloc() throw()
@@ -140,11 +152,12 @@ namespace BansheeEngine
 		}
 
 		/**
-		 * @brief	Allocate but don't initialize number elements of type T.
+		 * @brief	Allocate but don't initialize number elements of type T. Memory is aligned
+		 * 			according to the alignment requirements of T.
 		 */
 		pointer allocate(size_type num, const void* = 0)
 		{
-			pointer ret = (pointer)(mFrameAlloc->alloc((UINT32)num*sizeof(T)));
+			pointer ret = (pointer)(mFrameAlloc->alloc((UINT32)(num*sizeof(T)), (UINT32)std::alignment_of<T>::value));
 			return ret;
 		}
 
@@ -173,6 +186,9 @@ namespace BansheeEngine
 		}
 
 	private:
+		template <class U>
+		friend class StdFrameAlloc;
+
 		FrameAlloc* mFrameAlloc;
 	};
 
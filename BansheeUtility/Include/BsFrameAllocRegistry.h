@@ -0,0 +1,76 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+#include "BsFrameAlloc.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Keeps a separate set of frame allocators for every thread that requests one. This allows
+	 * 			any thread (e.g. task scheduler workers) to allocate transient per-frame data without
+	 * 			synchronization, as each thread only ever allocates from its own blocks.
+	 *
+	 * @note	Allocators are multi-buffered. Memory allocated during a frame remains valid for "NUM_FRAMES - 1"
+	 * 			frame advances, which allows it to be consumed by another thread (e.g. the core thread) that is
+	 * 			running behind.
+	 *
+	 *			Getting an allocator is thread safe and lock free. advanceFrame may only be called when no other
+	 *			thread is allocating from the registry, meaning tasks that allocate frame data must complete before
+	 *			the frame ends.
+	 */
+	class BS_UTILITY_EXPORT FrameAllocRegistry
+	{
+	public:
+		static const UINT32 NUM_FRAMES = 2;
+
+		/**
+		 * @brief	Constructs a new registry.
+		 *
+		 * @param	blockSize	Initial block size for each of the frame allocators.
+		 */
+		FrameAllocRegistry(UINT32 blockSize = 1024 * 1024);
+		~FrameAllocRegistry();
+
+		/**
+		 * @brief	Returns the frame allocator for the calling thread and the currently active frame.
+		 * 			Allocator is created on first use.
+		 */
+		FrameAlloc* getFrameAlloc();
+
+		/**
+		 * @brief	Makes the next frame active and clears the allocators of all threads for the new frame.
+		 *
+		 * @note	No other threads may allocate from the registry while this is executing.
+		 */
+		void advanceFrame();
+
+	private:
+		/**
+		 * @brief	Frame allocators belonging to a single thread.
+		 */
+		struct ThreadEntry
+		{
+			BS_THREAD_ID_TYPE threadId;
+			FrameAlloc* allocs[NUM_FRAMES];
+			ThreadEntry* next;
+		};
+
+		/**
+		 * @brief	Finds an existing entry for the calling thread, or creates a new one.
+		 */
+		ThreadEntry* findOrCreateEntry();
+
+		UINT32 mId;
+		UINT32 mBlockSize;
+		std::atomic<ThreadEntry*> mEntries;
+		std::atomic<UINT32> mActiveFrame;
+
+		static std::atomic<UINT32> NextId;
+
+		static BS_THREADLOCAL ThreadEntry* CachedEntry;
+		static BS_THREADLOCAL UINT32 CachedRegistryId;
+	};
+}
\ No newline at end of file
@@ -44,6 +44,7 @@ namespace BansheeEngine
 	class DataStream;
 	class MemoryDataStream;
 	class FileDataStream;
+	class MemoryMappedFile;
 	class MeshData;
 	class FileSystem;
 	class Timer;
@@ -58,13 +59,16 @@ namespace BansheeEngine
 	// Reflection
 	class IReflectable;
 	class RTTITypeBase;
+	class SerializationContext;
 	// Serialization
 	class ISerializable;
 	class SerializableType;
+	class MemorySerializer;
 
 	typedef std::shared_ptr<DataStream> DataStreamPtr;
 	typedef std::shared_ptr<MemoryDataStream> MemoryDataStreamPtr;
 	typedef std::shared_ptr<FileDataStream> FileDataStreamPtr;
+	typedef std::shared_ptr<MemoryMappedFile> MemoryMappedFilePtr;
 	typedef std::shared_ptr<MeshData> MeshDataPtr;
 	typedef std::shared_ptr<PixelData> PixelDataPtr;
 	typedef std::shared_ptr<GpuResourceData> GpuResourceDataPtr;
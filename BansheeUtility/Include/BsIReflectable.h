@@ -40,6 +40,8 @@ namespace BansheeEngine
 		/**
 		 * @brief	Returns true if current RTTI class is derived from "base".
 		 * 			(Or if it is the same type as base)
+		 *
+		 * @note	Constant time.
 		 */
 		bool isDerivedFrom(RTTITypeBase* base);
 
@@ -76,7 +78,27 @@ namespace BansheeEngine
 		 */
 		static bool _isTypeIdDuplicate(UINT32 typeId);
 
+		/**
+		 * @brief	Internal method. Adds the RTTI type to the global type registry, so it can be
+		 * 			found by its type id, and to the list of classes deriving from "baseType" (or from
+		 * 			IReflectable if null). Throws an exception if the type id is already in use.
+		 */
+		static void _registerRTTIType(RTTITypeBase* type, RTTITypeBase* baseType);
+
 	protected:
+		/**
+		 * @brief	Returns a map of all registered RTTI types, keyed by their type id.
+		 * 			Abstract types are not included.
+		 */
+		static UnorderedMap<UINT32, RTTITypeBase*>& getTypesById();
+
+		/**
+		 * @brief	Assigns a hierarchy index range to every registered type, so type relationships
+		 * 			can be checked in constant time. Only performs the work if new types were registered
+		 * 			since the last call.
+		 */
+		static void updateHierarchyIndices();
+
 		Any mRTTIData; // Temporary per-instance data storage used during various RTTI operations.
 					   // Needed since there is one RTTI class instance per type and sometimes we need per-instance data.
 	};
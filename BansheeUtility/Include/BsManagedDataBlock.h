@@ -27,6 +27,17 @@ namespace BansheeEngine
 		 */
 		ManagedDataBlock(UINT8* data, UINT32 size, std::function<void(UINT8*)> deallocator = nullptr); 
 
+		/**
+		 * @brief	Constructor for a data block referencing memory owned by some other object (e.g. a 
+		 * 			memory mapped file). No copying is done and the data is never freed by the block. Instead
+		 * 			the block and all of its copies keep a reference to the owner, keeping the data alive.
+		 *
+		 * @param 	data		Array of bytes to reference.
+		 * @param	size		Size of the array, in bytes.
+		 * @param	dataOwner	Object that owns the referenced memory.
+		 */
+		ManagedDataBlock(UINT8* data, UINT32 size, const std::shared_ptr<void>& dataOwner);
+
 		/**
 		 * @brief	Constructor that will automatically allocate an internal buffer of the specified size.
 		 * 			Copying ManagedDataBlock transfers ownership of the buffer to the copy of the buffer.
@@ -43,11 +54,18 @@ namespace BansheeEngine
 		UINT8* getData() { return mData; }
 		UINT32 getSize() { return mData ? mSize : 0; }
 
+		/**
+		 * @brief	Returns the object owning the referenced memory, if the block was created as a view of
+		 * 			memory owned by another object. Retain it for as long as the data is being used.
+		 */
+		const std::shared_ptr<void>& getDataOwner() const { return mDataOwner; }
+
 	private:
 		UINT8* mData;
 		UINT32 mSize;
 		bool mManaged;
 		std::function<void(UINT8*)> mDeallocator;
+		std::shared_ptr<void> mDataOwner;
 		mutable bool mIsDataOwner;
 	};
 }
\ No newline at end of file
@@ -7,7 +7,8 @@ namespace BansheeEngine
 {
 	/**
 	 * @brief	Specialized allocator for profiler so we can avoid tracking internal profiler memory allocations
-	 * 			which would skew profiler results.
+	 * 			which would skew profiler results. Its memory is tracked
+	 * 			under a separate MemoryCategory.
 	 */
 	class ProfilerAlloc
 	{};
@@ -25,7 +26,11 @@ namespace BansheeEngine
 		 */
 		static inline void* allocate(size_t bytes)
 		{
+#if BS_MEMORY_TRACKING_ENABLED
+			return MemoryTracker::trackAlloc(malloc(bytes + MemoryTracker::HEADER_SIZE), bytes, MemoryCategory::Profiler);
+#else
 			return malloc(bytes);
+#endif
 		}
 
 		/**
@@ -33,7 +38,11 @@ namespace BansheeEngine
 		 */
 		static inline void* allocateArray(size_t bytes, UINT32 count)
 		{
+#if BS_MEMORY_TRACKING_ENABLED
+			return MemoryTracker::trackAlloc(malloc(bytes * count + MemoryTracker::HEADER_SIZE), bytes * count, MemoryCategory::Profiler);
+#else
 			return malloc(bytes * count);
+#endif
 		}
 
 		/**
@@ -41,7 +50,11 @@ namespace BansheeEngine
 		 */
 		static inline void free(void* ptr)
 		{
+#if BS_MEMORY_TRACKING_ENABLED
+			::free(MemoryTracker::trackFree(ptr, MemoryCategory::Profiler));
+#else
 			::free(ptr);
+#endif
 		}
 
 		/**
@@ -50,7 +63,11 @@ namespace BansheeEngine
 		 */
 		static inline void freeArray(void* ptr, UINT32 count)
 		{
+#if BS_MEMORY_TRACKING_ENABLED
+			::free(MemoryTracker::trackFree(ptr, MemoryCategory::Profiler));
+#else
 			::free(ptr);
+#endif
 		}
 	};
 }
\ No newline at end of file
@@ -59,7 +59,7 @@ namespace BansheeEngine
 			void dealloc(UINT8* data, UINT32 amount)
 			{
 				mFreePtr -= amount;
-				assert((&mData[mFreePtr]) == data && "Out of order stack deallocation detected. Deallocations need to happen in order opposite of allocations.");
+				assert(data >= (&mData[mFreePtr]) && data < (&mData[mFreePtr + amount]) && "Out of order stack deallocation detected. Deallocations need to happen in order opposite of allocations.");
 			}
 
 			UINT8* mData;
@@ -121,6 +121,46 @@ namespace BansheeEngine
 			return data + sizeof(UINT32);
 		}
 
+		/**
+		 * @brief	Allocates the given amount of memory on the stack, aligned to the specified boundary.
+		 *
+		 * @param	amount		The amount to allocate in bytes.
+		 * @param	alignment	Alignment of the returned memory, in bytes. Must be a power of two.
+		 *
+		 * @note	Same as alloc(UINT32), except up to "alignment - 1" additional bytes might be used for padding.
+		 */
+		UINT8* alloc(UINT32 amount, UINT32 alignment)
+		{
+			assert((alignment & (alignment - 1)) == 0 && "Alignment must be a power of two.");
+
+			// Worst case size, so we know which block to use before knowing the exact padding
+			UINT32 maxAmount = amount + sizeof(UINT32) + alignment - 1;
+
+			MemBlock* topBlock;
+			if(mBlocks.size() == 0)
+				topBlock = allocBlock(maxAmount);
+			else
+				topBlock = mBlocks.top();
+
+			MemBlock* memBlock = nullptr;
+			UINT32 freeMem = topBlock->mSize - topBlock->mFreePtr;
+			if(maxAmount <= freeMem)
+				memBlock = topBlock;
+			else
+				memBlock = allocBlock(maxAmount);
+
+			UINT8* freePtr = &memBlock->mData[memBlock->mFreePtr] + sizeof(UINT32);
+			UINT32 padding = (UINT32)((alignment - ((size_t)freePtr & (alignment - 1))) & (alignment - 1));
+			UINT32 totalAmount = padding + sizeof(UINT32) + amount;
+
+			UINT8* data = memBlock->alloc(totalAmount) + padding;
+
+			UINT32* storedSize = reinterpret_cast<UINT32*>(data);
+			*storedSize = totalAmount;
+
+			return data + sizeof(UINT32);
+		}
+
 		/**
 		 * @brief	Deallocates the given memory. Data must be deallocated in opposite
 		 * 			order then when it was allocated.
@@ -206,6 +246,11 @@ namespace BansheeEngine
 		 */
 		static BS_UTILITY_EXPORT UINT8* alloc(UINT32 numBytes);
 
+		/**
+		 * @copydoc	MemoryStackInternal::alloc(UINT32, UINT32)
+		 */
+		static BS_UTILITY_EXPORT UINT8* alloc(UINT32 numBytes, UINT32 alignment);
+
 		/**
 		 * @copydoc	MemoryStackInternal::dealloc
 		 */
@@ -229,7 +274,7 @@ namespace BansheeEngine
 	template<class T>
 	T* stackAlloc()
 	{
-		return (T*)MemStack::alloc(sizeof(T));
+		return (T*)MemStack::alloc(sizeof(T), (UINT32)std::alignment_of<T>::value);
 	}
 
 	/**
@@ -241,7 +286,7 @@ namespace BansheeEngine
 	template<class T>
 	T* stackAllocN(UINT32 count)
 	{
-		return (T*)MemStack::alloc(sizeof(T) * count);
+		return (T*)MemStack::alloc(sizeof(T) * count, (UINT32)std::alignment_of<T>::value);
 	}
 
 	/**
@@ -7,6 +7,9 @@
 #undef max
 
 #include <atomic>
+#include <type_traits>
+
+#include "BsMemoryTracker.h"
 
 namespace BansheeEngine
 {
@@ -68,7 +71,11 @@ namespace BansheeEngine
 			incAllocCount();
 #endif
 
+#if BS_MEMORY_TRACKING_ENABLED
+			return MemoryTracker::trackAlloc(malloc(bytes + MemoryTracker::HEADER_SIZE), bytes, MemoryCategory::General);
+#else
 			return malloc(bytes);
+#endif
 		}
 
 		static inline void* allocateArray(size_t bytes, UINT32 count)
@@ -77,7 +84,11 @@ namespace BansheeEngine
 			incAllocCount();
 #endif
 
+#if BS_MEMORY_TRACKING_ENABLED
+			return MemoryTracker::trackAlloc(malloc(bytes * count + MemoryTracker::HEADER_SIZE), bytes * count, MemoryCategory::General);
+#else
 			return malloc(bytes * count);
+#endif
 		}
 
 		static inline void free(void* ptr)
@@ -86,7 +97,11 @@ namespace BansheeEngine
 			incFreeCount();
 #endif
 
+#if BS_MEMORY_TRACKING_ENABLED
+			::free(MemoryTracker::trackFree(ptr, MemoryCategory::General));
+#else
 			::free(ptr);
+#endif
 		}
 
 		static inline void freeArray(void* ptr, UINT32 count)
@@ -95,7 +110,11 @@ namespace BansheeEngine
 			incFreeCount();
 #endif
 
+#if BS_MEMORY_TRACKING_ENABLED
+			::free(MemoryTracker::trackFree(ptr, MemoryCategory::General));
+#else
 			::free(ptr);
+#endif
 		}
 	};
 
@@ -107,19 +126,20 @@ namespace BansheeEngine
 	{ };
 
 	/**
-	 * @brief	Allocator used for allocating small amounts of temporary memory that
-	 * 			used and then quickly released
+	 * @brief	Allocator used for allocating temporary memory that is used and then quickly released.
+	 * 			Allocations made while a ScratchScope is active are released when the scope ends, so never
+	 * 			use it for data that needs to outlive the function, or that is passed to another thread.
 	 * 			
-	 * @note	Currently not used.
+	 * @see		ScratchAllocator
 	 */
 	class ScratchAlloc
 	{ };
 
 	/**
-	 * @brief	Pool allocator that is only suited for allocating one specific type of data. Most useful when you are
-	 * 			often allocating one certain data type, with no specific allocation or deallocation order.
+	 * @brief	Pool allocator best suited for small objects that are often allocated and freed, with no 
+	 * 			specific allocation or deallocation order.
 	 * 			
-	 * @note	Currently not used.
+	 * @see		PoolAllocator
 	 */
 	class PoolAlloc
 	{ };
@@ -197,6 +217,60 @@ namespace BansheeEngine
 		MemoryAllocator<Alloc>::freeArray(ptr, count);
 	}
 
+	/**
+	 * @brief	Allocates the specified number of bytes, aligned to the specified boundary. 
+	 * 			Memory must be freed with bs_free_aligned.
+	 *
+	 * @param	count		Number of bytes to allocate.
+	 * @param	alignment	Alignment of the returned memory. Must be a power of two.
+	 */
+	template<class Alloc> 
+	inline void* bs_alloc_aligned(size_t count, size_t alignment)
+	{
+		assert((alignment & (alignment - 1)) == 0 && "Alignment must be a power of two.");
+
+		// Store the original address right before the aligned memory, so it can be freed
+		UINT8* data = (UINT8*)MemoryAllocator<Alloc>::allocate(count + alignment - 1 + sizeof(void*));
+		UINT8* alignedData = (UINT8*)(((size_t)(data + sizeof(void*)) + alignment - 1) & ~(alignment - 1));
+
+		((void**)alignedData)[-1] = data;
+		return alignedData;
+	}
+
+	/**
+	 * @brief	Frees memory allocated with bs_alloc_aligned.
+	 */
+	template<class Alloc> 
+	inline void bs_free_aligned(void* ptr)
+	{
+		if(ptr == nullptr)
+			return;
+
+		MemoryAllocator<Alloc>::free(((void**)ptr)[-1]);
+	}
+
+	/**
+	 * @brief	Create a new object with the specified allocator and the specified parameters. Memory is aligned according
+	 * 			to the alignment requirements of the type, which makes it usable for over-aligned (e.g. SIMD) types.
+	 * 			Object must be destroyed with bs_delete_aligned.
+	 */
+	template<class Type, class Alloc, class... Args>
+	Type* bs_new_aligned(Args &&...args)
+	{
+		return new (bs_alloc_aligned<Alloc>(sizeof(Type), std::alignment_of<Type>::value)) Type(std::forward<Args>(args)...);
+	}
+
+	/**
+	 * @brief	Destructs and frees an object created with bs_new_aligned.
+	 */
+	template<class Alloc, class T> 
+	inline void bs_delete_aligned(T* ptr)
+	{
+		(ptr)->~T();
+
+		bs_free_aligned<Alloc>(ptr);
+	}
+
 	/*****************************************************************************/
 	/* Default versions of all alloc/free/new/delete methods which call GenAlloc */
 	/*****************************************************************************/
@@ -273,6 +347,42 @@ namespace BansheeEngine
 	}
 
 
+	/**
+	 * @copydoc	bs_alloc_aligned(size_t, size_t)
+	 */
+	inline void* bs_alloc_aligned(size_t count, size_t alignment)
+	{
+		return bs_alloc_aligned<GenAlloc>(count, alignment);
+	}
+
+	/**
+	 * @copydoc	bs_free_aligned(void*)
+	 */
+	inline void bs_free_aligned(void* ptr)
+	{
+		bs_free_aligned<GenAlloc>(ptr);
+	}
+
+	/**
+	 * @copydoc	bs_new_aligned
+	 */
+	template<class Type, class... Args>
+	Type* bs_new_aligned(Args &&...args)
+	{
+		return new (bs_alloc_aligned<GenAlloc>(sizeof(Type), std::alignment_of<Type>::value)) Type(std::forward<Args>(args)...);
+	}
+
+	/**
+	 * @copydoc	bs_delete_aligned
+	 */
+	template<class T> 
+	inline void bs_delete_aligned(T* ptr)
+	{
+		(ptr)->~T();
+
+		bs_free_aligned<GenAlloc>(ptr);
+	}
+
 /************************************************************************/
 /* 							MACRO VERSIONS                      		*/
 /* You will almost always want to use the template versions but in some */
@@ -407,4 +517,6 @@ namespace BansheeEngine
 }
 
 #include "BsMemStack.h"
+#include "BsPoolAlloc.h"
+#include "BsScratchAlloc.h"
 #include "BsMemAllocProfiler.h"
\ No newline at end of file
@@ -0,0 +1,51 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Maps contents of a file into the address space of the process, allowing the file
+	 * 			to be accessed like a normal memory buffer without explicitly reading it. The OS
+	 * 			loads the file pages on demand, as they are accessed.
+	 *
+	 * @note	Mapping is copy-on-write. Mapped data may be modified, but the changes are never
+	 * 			written back to the file.
+	 *
+	 *			File remains open for as long as the mapping exists.
+	 */
+	class BS_UTILITY_EXPORT MemoryMappedFile
+	{
+	public:
+		/**
+		 * @brief	Maps the file at the specified path. Throws an exception if the file cannot be mapped.
+		 *
+		 * @param	fullPath	Full path to a file.
+		 */
+		MemoryMappedFile(const Path& fullPath);
+		~MemoryMappedFile();
+
+		/**
+		 * @brief	Returns a pointer to the start of the mapped file contents.
+		 */
+		UINT8* getData() const { return mData; }
+
+		/**
+		 * @brief	Returns the size of the mapped file contents, in bytes.
+		 */
+		UINT64 getSize() const { return mSize; }
+
+	private:
+		MemoryMappedFile(const MemoryMappedFile& other) { }
+		MemoryMappedFile& operator=(const MemoryMappedFile& rhs) { return *this; }
+
+		UINT8* mData;
+		UINT64 mSize;
+
+		void* mFileHandle;
+		void* mMappingHandle;
+	};
+}
\ No newline at end of file
@@ -12,12 +12,6 @@ namespace BansheeEngine
 	  */
 	class BS_UTILITY_EXPORT MemorySerializer
 	{
-		struct BufferPiece
-		{
-			UINT8* buffer;
-			UINT32 size;
-		};
-
 	public:
 		MemorySerializer();
 		~MemorySerializer();
@@ -26,10 +20,30 @@ namespace BansheeEngine
 		 * @brief	Parses the provided object, serializes all of its data as specified by its
 		 *			RTTIType and returns the data in the form of raw memory.
 		 *
-		 *			All memory is allocated using the provided "allocator". If not specified the default
-		 *			allocator is used.
+		 *			If "allocator" is not specified the data is encoded directly into memory allocated
+		 *			with bs_alloc, which is returned without any additional copies and must be freed with bs_free.
+		 *
+		 *			If "allocator" is specified the data is first encoded into an internal buffer, and then
+		 *			copied into a single allocation made by "allocator". The internal buffer is kept
+		 *			between calls, so reusing the same serializer for multiple objects doesn't allocate
+		 *			anything other than the returned memory, once the buffer has grown large enough.
+		 *
+		 *			If "parallel" is true, objects are encoded in parallel using the TaskScheduler. See BinarySerializer::encode.
+		 */
+		UINT8* encode(IReflectable* object, UINT32& bytesWritten, std::function<void*(UINT32)> allocator = nullptr, 
+			bool parallel = false);
+
+		/**
+		 * @brief	Parses the provided object, serializes all of its data as specified by its RTTIType and returns the 
+		 *			data in the serializers internal buffer. Returned memory remains owned by the serializer and is only 
+		 *			valid until the next call to encode or encodeToBuffer.
+		 *
+		 *			The internal buffer is kept between calls, so reusing the same serializer for multiple objects
+		 *			(e.g. when cloning) doesn't allocate any memory once the buffer has grown large enough.
+		 *
+		 *			If "parallel" is true, objects are encoded in parallel using the TaskScheduler. See BinarySerializer::encode.
 		 */
-		UINT8* encode(IReflectable* object, UINT32& bytesWritten, std::function<void*(UINT32)> allocator = nullptr);
+		UINT8* encodeToBuffer(IReflectable* object, UINT32& bytesWritten, bool parallel = false);
 
 		/**
 		 * @brief	Deserializes an IReflectable object by reading the binary data from the provided
@@ -38,10 +52,13 @@ namespace BansheeEngine
 		std::shared_ptr<IReflectable> decode(UINT8* buffer, UINT32 bufferSize);
 
 	private:
-		Vector<BufferPiece> mBufferPieces;
+		UINT8* mBuffer;
+		UINT32 mBufferSize;
+		UINT32 mBufferUsed;
 
 		/**
-		 * @brief	Called by the binary serializer whenever the buffer gets full.
+		 * @brief	Called by the binary serializer whenever the buffer gets full. Grows the buffer
+		 *			geometrically while preserving its contents.
 		 */
 		UINT8* flushBuffer(UINT8* bufferStart, int bytesWritten, UINT32& newBufferSize);
 
@@ -49,6 +66,6 @@ namespace BansheeEngine
 		/* 								CONSTANTS	                     		*/
 		/************************************************************************/
 	private:
-		static const UINT32 WRITE_BUFFER_SIZE = 2048;
+		static const UINT32 INITIAL_BUFFER_SIZE = 2048;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,179 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsThreadDefines.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Allocator categories tracked by the MemoryTracker.
+	 */
+	enum class MemoryCategory
+	{
+		General, /**< GenAlloc and any category without a specialized allocator. */
+		Pool, /**< PoolAlloc */
+		Scratch, /**< ScratchAlloc */
+		Profiler, /**< ProfilerAlloc */
+		Count // Keep at end
+	};
+
+	/**
+	 * @brief	Memory usage statistics for a single allocator category.
+	 */
+	struct MemoryCategoryStats
+	{
+		UINT64 currentBytes; /**< Number of bytes currently allocated. */
+		UINT64 peakBytes; /**< Highest number of bytes that were allocated at the end of any frame. */
+		UINT64 numAllocs; /**< Total number of allocations. */
+		UINT64 numFrees; /**< Total number of deallocations. */
+
+		UINT64 frameAllocBytes; /**< Number of bytes allocated during the last frame. */
+		UINT64 frameFreeBytes; /**< Number of bytes freed during the last frame. */
+		UINT64 frameNumAllocs; /**< Number of allocations during the last frame. */
+		UINT64 frameNumFrees; /**< Number of deallocations during the last frame. */
+	};
+
+	/**
+	 * @brief	Memory usage statistics for allocations made under a single tag.
+	 *
+	 * @see		MemoryTagScope
+	 */
+	struct MemoryTagStats
+	{
+		const char* name; /**< Name the tag was registered with. */
+		UINT64 currentBytes; /**< Number of bytes currently allocated. */
+		UINT64 peakBytes; /**< Highest number of bytes that were allocated at the end of any frame. */
+		UINT64 numAllocs; /**< Total number of allocations. */
+	};
+
+	/**
+	 * @brief	Keeps track of the number of bytes allocated by each allocator category, and optionally by
+	 * 			call site tags. Used by MemoryAllocator implementations when BS_MEMORY_TRACKING_ENABLED is set.
+	 *
+	 * @note	Each tracked allocation is prefixed with a small header storing its size and tag, unless the
+	 *			allocator stores them itself.
+	 *
+	 *			Allocations are counted by the thread that makes them, without touching any shared state. Counts of
+	 *			all threads are combined in endFrame, so reported statistics only change once per frame.
+	 *
+	 *			Thread safe.
+	 */
+	class MemoryTracker
+	{
+	public:
+		/**
+		 * @brief	Number of bytes that need to be allocated on top of the requested size for every tracked allocation.
+		 */
+		static const UINT32 HEADER_SIZE = 16;
+
+		/**
+		 * @brief	Maximum number of tags that can be registered. Any further tags will be treated as untagged.
+		 */
+		static const UINT32 MAX_TAGS = 64;
+
+		/**
+		 * @brief	Records a new allocation.
+		 *
+		 * @param	data		Memory returned by the allocator, at least HEADER_SIZE + bytes in size.
+		 * @param	bytes		Number of bytes requested by the caller.
+		 * @param	category	Category of the allocator that made the allocation.
+		 *
+		 * @return	Address to return to the caller.
+		 */
+		static BS_UTILITY_EXPORT void* trackAlloc(void* data, size_t bytes, MemoryCategory category);
+
+		/**
+		 * @brief	Records a deallocation of memory previously returned by trackAlloc.
+		 *
+		 * @return	Address that was originally returned by the allocator, that needs to be freed.
+		 */
+		static BS_UTILITY_EXPORT void* trackFree(void* ptr, MemoryCategory category);
+
+		/**
+		 * @brief	Records a new allocation without a tracking header. Used by allocators that store the size 
+		 *			and the tag of their allocations themselves.
+		 *
+		 * @return	Tag the allocation was made under. Must be provided when the allocation is freed.
+		 */
+		static BS_UTILITY_EXPORT UINT32 trackAlloc(size_t bytes, MemoryCategory category);
+
+		/**
+		 * @brief	Records a deallocation of memory previously recorded with the headerless trackAlloc.
+		 */
+		static BS_UTILITY_EXPORT void trackFree(size_t bytes, UINT32 tag, MemoryCategory category);
+
+		/**
+		 * @brief	Registers a new allocation tag and returns its identifier. Registering the same name
+		 * 			multiple times returns the same identifier.
+		 *
+		 * @param	name	Name of the tag. Must remain valid for the lifetime of the application, normally a string literal.
+		 */
+		static BS_UTILITY_EXPORT UINT32 registerTag(const char* name);
+
+		/**
+		 * @brief	Returns the number of registered tags, including the default "Untagged" tag.
+		 */
+		static BS_UTILITY_EXPORT UINT32 getNumTags();
+
+		/**
+		 * @brief	Returns memory statistics for the specified allocator category.
+		 */
+		static BS_UTILITY_EXPORT MemoryCategoryStats getCategoryStats(MemoryCategory category);
+
+		/**
+		 * @brief	Returns memory statistics for the tag with the specified identifier.
+		 */
+		static BS_UTILITY_EXPORT MemoryTagStats getTagStats(UINT32 tag);
+
+		/**
+		 * @brief	Ends the current frame. Combines the counts of all threads, making per-frame statistics of
+		 *			the current frame available and starting new ones.
+		 *
+		 * @note	Should be called once per frame, from a single thread.
+		 */
+		static BS_UTILITY_EXPORT void endFrame();
+
+		/**
+		 * @brief	Should be called when a thread that made tracked allocations is about to end, so that its
+		 *			counters may be reused by other threads.
+		 */
+		static BS_UTILITY_EXPORT void endThread();
+
+	private:
+		friend class MemoryTagScope;
+
+		static BS_THREADLOCAL UINT32 ActiveTag;
+	};
+
+	/**
+	 * @brief	Tags all tracked allocations made on the current thread with the provided tag, while the scope is active.
+	 * 			Scopes can be nested, in which case the innermost tag is used.
+	 *
+	 * @see		BS_MEMORY_TAG
+	 */
+	class BS_UTILITY_EXPORT MemoryTagScope
+	{
+	public:
+		MemoryTagScope(UINT32 tag);
+		~MemoryTagScope();
+
+	private:
+		UINT32 mPrevTag;
+	};
+}
+
+#if BS_MEMORY_TRACKING_ENABLED
+#define BS_MEMORY_TAG_CONCAT_INTERNAL(a, b) a##b
+#define BS_MEMORY_TAG_CONCAT(a, b) BS_MEMORY_TAG_CONCAT_INTERNAL(a, b)
+
+/**
+ * @brief	Tags all allocations made by the current thread, until the end of the enclosing scope, with the provided name.
+ */
+#define BS_MEMORY_TAG(name) \
+	static UINT32 BS_MEMORY_TAG_CONCAT(bsMemoryTagId, __LINE__) = BansheeEngine::MemoryTracker::registerTag(name); \
+	BansheeEngine::MemoryTagScope BS_MEMORY_TAG_CONCAT(bsMemoryTagScope, __LINE__)(BS_MEMORY_TAG_CONCAT(bsMemoryTagId, __LINE__));
+#else
+#define BS_MEMORY_TAG(name)
+#endif
\ No newline at end of file
@@ -0,0 +1,110 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Splits a range of indices into chunks and executes them in parallel using the TaskScheduler.
+	 *			Calling thread executes chunks as well and returns once the entire range has been processed.
+	 *			
+	 * @note	Chunks start out large and get smaller as the range is being processed, so that threads finishing
+	 *			early can balance out the load of other threads. Chunks are never smaller than the grain size.
+	 *			
+	 *			If the TaskScheduler isn't started the entire range is processed on the calling thread.
+	 */
+	class BS_UTILITY_EXPORT ParallelRange
+	{
+	public:
+		/**
+		 * @brief	Method executed for each chunk. Receives the index of the thread executing the chunk,
+		 *			in range [0, numThreads), and the first and one past last index of the chunk.
+		 */
+		typedef std::function<void(UINT32, UINT32, UINT32)> ChunkWorker;
+
+		/**
+		 * @brief	Returns the maximum number of threads that will be processing the provided range.
+		 *
+		 * @param	begin		First index in the range.
+		 * @param	end			One past the last index in the range.
+		 * @param	grainSize	Minimum number of indices processed at once. Zero to determine automatically.
+		 */
+		static UINT32 getNumThreads(UINT32 begin, UINT32 end, UINT32 grainSize);
+
+		/**
+		 * @brief	Processes the provided range in parallel. 
+		 *
+		 * @param	begin		First index in the range.
+		 * @param	end			One past the last index in the range.
+		 * @param	grainSize	Minimum number of indices processed at once. Zero to determine automatically.
+		 * @param	numThreads	Number of threads to process the range with, as returned by getNumThreads.
+		 * @param	worker		Method to execute for each chunk.
+		 */
+		static void execute(UINT32 begin, UINT32 end, UINT32 grainSize, UINT32 numThreads, const ChunkWorker& worker);
+
+	private:
+		/**
+		 * @brief	Returns the provided grain size, or an automatically determined one if the provided grain size is zero.
+		 */
+		static UINT32 getGrainSize(UINT32 count, UINT32 grainSize, UINT32 numThreads);
+	};
+
+	/**
+	 * @brief	Executes the provided method for each index in range [begin, end), in parallel.
+	 *
+	 * @param	begin		First index in the range.
+	 * @param	end			One past the last index in the range.
+	 * @param	body		Method with signature void(UINT32 idx), executed for each index. Must be safe to
+	 *						execute concurrently for different indices.
+	 * @param	grainSize	(optional) Minimum number of indices processed by a thread at once. Zero to determine
+	 *						automatically.
+	 */
+	template<class Body>
+	void parallelFor(UINT32 begin, UINT32 end, Body body, UINT32 grainSize = 0)
+	{
+		UINT32 numThreads = ParallelRange::getNumThreads(begin, end, grainSize);
+		ParallelRange::execute(begin, end, grainSize, numThreads, 
+			[&](UINT32 threadIdx, UINT32 chunkBegin, UINT32 chunkEnd)
+		{
+			for (UINT32 i = chunkBegin; i < chunkEnd; i++)
+				body(i);
+		});
+	}
+
+	/**
+	 * @brief	Reduces the range [begin, end) into a single value, processing the range in parallel.
+	 *
+	 * @param	begin		First index in the range.
+	 * @param	end			One past the last index in the range.
+	 * @param	identity	Initial value of the reduction. Combining any value with the identity must yield the
+	 *						same value.
+	 * @param	body		Method with signature T(UINT32 begin, UINT32 end, const T& value) that reduces the
+	 *						indices in the provided chunk into the provided value, and returns the result.
+	 * @param	combine		Method with signature T(const T& a, const T& b) that combines two partial results.
+	 *						Must be associative and commutative as the order in which partial results are 
+	 *						combined is not defined.
+	 * @param	grainSize	(optional) Minimum number of indices processed by a thread at once. Zero to determine
+	 *						automatically.
+	 */
+	template<class T, class Body, class Combine>
+	T parallelReduce(UINT32 begin, UINT32 end, const T& identity, Body body, Combine combine, UINT32 grainSize = 0)
+	{
+		UINT32 numThreads = ParallelRange::getNumThreads(begin, end, grainSize);
+
+		Vector<T> partialResults(numThreads, identity);
+		ParallelRange::execute(begin, end, grainSize, numThreads, 
+			[&](UINT32 threadIdx, UINT32 chunkBegin, UINT32 chunkEnd)
+		{
+			partialResults[threadIdx] = body(chunkBegin, chunkEnd, partialResults[threadIdx]);
+		});
+
+		T result = identity;
+		for (auto& partialResult : partialResults)
+			result = combine(result, partialResult);
+
+		return result;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,142 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsThreadDefines.h"
+
+namespace BansheeEngine
+{
+	struct PoolAllocThreadCache;
+
+	/**
+	 * @brief	Allocation statistics for a single PoolAllocator size class.
+	 */
+	struct PoolAllocStats
+	{
+		UINT32 blockSize; /**< Largest allocation, in bytes, served by the size class. */
+		UINT64 numAllocs; /**< Total number of allocations made from the size class. */
+		UINT64 numFrees; /**< Total number of blocks returned to the size class. */
+		UINT64 numChunks; /**< Number of chunks allocated from the OS in order to provide blocks for the size class. */
+	};
+
+	/**
+	 * @brief	General purpose allocator optimized for small objects. Allocations are rounded up
+	 * 			to one of a fixed set of size classes, and each size class keeps a list of free blocks
+	 * 			that are recycled for new allocations. Blocks are carved out from large chunks, reducing
+	 * 			both the per allocation overhead and heap fragmentation.
+	 *
+	 * @note	Each thread caches free blocks locally so most allocations and deallocations happen without
+	 * 			any synchronization. Cached blocks are exchanged with a shared pool in batches.
+	 *
+	 *			Allocations larger than the largest size class are forwarded to the OS allocator.
+	 *
+	 *			Thread safe. Memory can be freed on a different thread than it was allocated on.
+	 *			Call releaseThreadCache before a thread exits, otherwise blocks cached by that thread
+	 *			cannot be reused.
+	 */
+	class PoolAllocator
+	{
+	public:
+		/**
+		 * @brief	Allocates a block of memory large enough to hold the specified number of bytes.
+		 * 			Returned memory is 16 byte aligned.
+		 *
+		 * @note	Allocations are recorded by the MemoryTracker, if enabled. Tracking data is kept in the block
+		 *			header, so it doesn't affect which size class is used.
+		 */
+		static BS_UTILITY_EXPORT void* allocate(size_t bytes);
+
+		/**
+		 * @brief	Frees memory previously allocated with allocate().
+		 */
+		static BS_UTILITY_EXPORT void free(void* ptr);
+
+		/**
+		 * @brief	Returns all blocks cached by the calling thread to the shared pool, and frees the cache.
+		 * 			The thread may continue using the allocator after this call, in which case a new cache
+		 * 			will be created.
+		 */
+		static BS_UTILITY_EXPORT void releaseThreadCache();
+
+		/**
+		 * @brief	Returns the number of size classes used by the allocator.
+		 */
+		static BS_UTILITY_EXPORT UINT32 getNumSizeClasses();
+
+		/**
+		 * @brief	Returns allocation statistics for the size class with the specified index.
+		 *
+		 * @note	Statistics are gathered from all threads, without stopping them, so values
+		 * 			are only approximate while other threads are allocating.
+		 */
+		static BS_UTILITY_EXPORT PoolAllocStats getStats(UINT32 sizeClass);
+
+	private:
+		/**
+		 * @brief	Returns the cache for the calling thread, creating it if needed.
+		 */
+		static PoolAllocThreadCache* getThreadCache();
+
+		/**
+		 * @brief	Fills the thread cache with free blocks of the specified size class,
+		 * 			either from the shared pool or by allocating a new chunk.
+		 */
+		static void refill(PoolAllocThreadCache* cache, UINT32 sizeClass);
+
+		/**
+		 * @brief	Moves the specified number of blocks of the specified size class from
+		 * 			the thread cache into the shared pool.
+		 */
+		static void release(PoolAllocThreadCache* cache, UINT32 sizeClass, UINT32 count);
+
+		static BS_THREADLOCAL PoolAllocThreadCache* ActiveCache;
+	};
+
+	/**
+	 * @brief	Specialized memory allocator implementation that uses the size class
+	 * 			pool allocator for the PoolAlloc category.
+	 *
+	 * @see		PoolAllocator
+	 */
+	template<>
+	class MemoryAllocator<PoolAlloc> : public MemoryAllocatorBase
+	{
+	public:
+		static inline void* allocate(size_t bytes)
+		{
+#if BS_PROFILING_ENABLED
+			incAllocCount();
+#endif
+
+			return PoolAllocator::allocate(bytes);
+		}
+
+		static inline void* allocateArray(size_t bytes, UINT32 count)
+		{
+#if BS_PROFILING_ENABLED
+			incAllocCount();
+#endif
+
+			return PoolAllocator::allocate(bytes * count);
+		}
+
+		static inline void free(void* ptr)
+		{
+#if BS_PROFILING_ENABLED
+			incFreeCount();
+#endif
+
+			PoolAllocator::free(ptr);
+		}
+
+		static inline void freeArray(void* ptr, UINT32 count)
+		{
+#if BS_PROFILING_ENABLED
+			incFreeCount();
+#endif
+
+			PoolAllocator::free(ptr);
+		}
+	};
+}
\ No newline at end of file
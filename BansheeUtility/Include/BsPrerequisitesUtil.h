@@ -12,6 +12,13 @@
 
 #define BS_PROFILING_ENABLED 1
 
+// When enabled every allocation made through MemoryAllocator is tracked per category and per tag (see MemoryTracker).
+// Adds a 16 byte header to each allocation. Allocations are counted per thread, so tracking doesn't introduce any
+// contention between threads that allocate. Enabled in debug builds by default.
+#ifndef BS_MEMORY_TRACKING_ENABLED
+#define BS_MEMORY_TRACKING_ENABLED BS_DEBUG_MODE
+#endif
+
 // Versions
 
 #define BS_VER_DEV 1
@@ -59,7 +59,23 @@ namespace BansheeEngine
 		// it is not guaranteed the value provided is fully initialized, so you should not access any of its
 		// data until deserialization is fully complete. You only need to use this flag if the RTTI system
 		// complains that is has found a circular reference.
-		RTTI_Flag_WeakRef = 0x01
+		RTTI_Flag_WeakRef = 0x01,
+
+		// This flag is only used on plain array fields whose element type has a static size and is serialized
+		// using a memcpy (e.g. built-in types, or types registered with BS_ALLOW_MEMCPY_SERIALIZATION). It signals
+		// that the elements returned by the array getter are stored one after another in memory (e.g. in a Vector), 
+		// which allows the serializers to copy the entire array at once, instead of element by element.
+		//
+		// When this flag is set, the element getter must return a reference to the actual element storage, and elements
+		// will be written directly into that storage when deserializing (the element setter is not called).
+		RTTI_Flag_ContiguousArray = 0x02,
+
+		// This flag is only used on data block fields. It signals that the field setter can accept a data block
+		// referencing external memory (e.g. a memory mapped file), instead of only memory returned by the field allocator.
+		// When decoding from such memory the data is not copied. Instead the data block passed to the setter references 
+		// the data in place, and holds a reference to the owner of that memory, which the setter must retain for as long 
+		// as it uses the data. Data for such fields is also aligned when encoding, so it may be used in place.
+		RTTI_Flag_DataBlockView = 0x04
 	};
 
 	/**
@@ -122,7 +122,7 @@ namespace BansheeEngine
 		virtual UINT8* allocate(void* object, UINT32 bytes)
 		{
 			if(mCustomAllocator.empty())
-				return (UINT8*)bs_alloc<ScratchAlloc>(bytes);
+				return (UINT8*)bs_alloc<GenAlloc>(bytes);
 			else
 			{
 				ObjectType* castObj = static_cast<ObjectType*>(object);
@@ -68,6 +68,18 @@ namespace BansheeEngine
 			return 0;
 		}
 
+		/**
+		 * @brief	Returns a pointer to the first element of the array contained in the provided object, if
+		 * 			array elements can be copied to and from it directly as one contiguous block. Returns null
+		 * 			if elements must be accessed one by one.
+		 *
+		 * @note	Only supported for array fields registered with RTTI_Flag_ContiguousArray. Array must not be empty.
+		 */
+		virtual UINT8* getArrayData(void* object)
+		{
+			return nullptr;
+		}
+
 		/**
 		 * @brief	Retrieves the value from the provided field of the provided object, and copies
 		 * 			it into the buffer. WARNING - It does not check if buffer is large enough.
@@ -98,9 +110,168 @@ namespace BansheeEngine
 	};
 
 	/**
-	 * @brief	Represents a plain class field containing a specific type.
+	 * @brief	Provides access to the value of a plain field through getter/setter functions provided at runtime,
+	 * 			type erased in an "Any". Functions are unwrapped once, when the field is initialized.
+	 *
+	 * @see		RTTIPlainField
+	 */
+	template <class DataType, class ObjectType>
+	struct RTTIPlainFunctionAccessor
+	{
+		/**
+		 * @brief	Unwraps the provided getter and setter functions. See RTTIPlainField::initSingle and
+		 * 			RTTIPlainField::initArray for required function signatures.
+		 */
+		void init(Any getter, Any setter, Any getSize, Any setSize, bool isArray)
+		{
+			if(isArray)
+			{
+				mArrayGetter = any_cast<std::function<DataType&(ObjectType*, UINT32)>>(getter);
+				mSizeGetter = any_cast<std::function<UINT32(ObjectType*)>>(getSize);
+
+				if(!setter.empty())
+					mArraySetter = any_cast<std::function<void(ObjectType*, UINT32, DataType&)>>(setter);
+
+				if(!setSize.empty())
+					mSizeSetter = any_cast<std::function<void(ObjectType*, UINT32)>>(setSize);
+			}
+			else
+			{
+				mGetter = any_cast<std::function<DataType&(ObjectType*)>>(getter);
+
+				if(!setter.empty())
+					mSetter = any_cast<std::function<void(ObjectType*, DataType&)>>(setter);
+			}
+		}
+
+		DataType& getValue(ObjectType* object) { return mGetter(object); }
+		void setValue(ObjectType* object, DataType& value) { mSetter(object, value); }
+		bool hasSetter() const { return mSetter || mArraySetter; }
+
+		DataType& getArrayValue(ObjectType* object, UINT32 index) { return mArrayGetter(object, index); }
+		void setArrayValue(ObjectType* object, UINT32 index, DataType& value) { mArraySetter(object, index, value); }
+
+		UINT32 getArraySize(ObjectType* object) { return mSizeGetter(object); }
+		void setArraySize(ObjectType* object, UINT32 size) { mSizeSetter(object, size); }
+		bool hasArraySizeSetter() const { return (bool)mSizeSetter; }
+
+	private:
+		std::function<DataType&(ObjectType*)> mGetter;
+		std::function<void(ObjectType*, DataType&)> mSetter;
+		std::function<DataType&(ObjectType*, UINT32)> mArrayGetter;
+		std::function<void(ObjectType*, UINT32, DataType&)> mArraySetter;
+		std::function<UINT32(ObjectType*)> mSizeGetter;
+		std::function<void(ObjectType*, UINT32)> mSizeSetter;
+	};
+
+	/**
+	 * @brief	Provides access to the value of a plain field through getter/setter methods on an RTTI
+	 * 			type (InterfaceType). Methods are called directly through member function pointers.
+	 *
+	 * @see		RTTIPlainField
+	 */
+	template <class DataType, class ObjectType, class InterfaceType>
+	struct RTTIPlainInterfaceAccessor
+	{
+		typedef DataType& (InterfaceType::*Getter)(ObjectType*);
+		typedef void (InterfaceType::*Setter)(ObjectType*, DataType&);
+		typedef DataType& (InterfaceType::*ArrayGetter)(ObjectType*, UINT32);
+		typedef void (InterfaceType::*ArraySetter)(ObjectType*, UINT32, DataType&);
+		typedef UINT32 (InterfaceType::*SizeGetter)(ObjectType*);
+		typedef void (InterfaceType::*SizeSetter)(ObjectType*, UINT32);
+
+		RTTIPlainInterfaceAccessor()
+			:mInterface(nullptr), mGetter(nullptr), mSetter(nullptr), mArrayGetter(nullptr), 
+			mArraySetter(nullptr), mSizeGetter(nullptr), mSizeSetter(nullptr)
+		{ }
+
+		/**
+		 * @brief	Initializes an accessor for a field containing a single value.
+		 */
+		void initSingle(InterfaceType* rttiInterface, Getter getter, Setter setter)
+		{
+			mInterface = rttiInterface;
+			mGetter = getter;
+			mSetter = setter;
+		}
+
+		/**
+		 * @brief	Initializes an accessor for a field containing an array of values.
+		 */
+		void initArray(InterfaceType* rttiInterface, ArrayGetter getter, SizeGetter getSize, ArraySetter setter, SizeSetter setSize)
+		{
+			mInterface = rttiInterface;
+			mArrayGetter = getter;
+			mSizeGetter = getSize;
+			mArraySetter = setter;
+			mSizeSetter = setSize;
+		}
+
+		DataType& getValue(ObjectType* object) { return (mInterface->*mGetter)(object); }
+		void setValue(ObjectType* object, DataType& value) { (mInterface->*mSetter)(object, value); }
+		bool hasSetter() const { return mSetter != nullptr || mArraySetter != nullptr; }
+
+		DataType& getArrayValue(ObjectType* object, UINT32 index) { return (mInterface->*mArrayGetter)(object, index); }
+		void setArrayValue(ObjectType* object, UINT32 index, DataType& value) { (mInterface->*mArraySetter)(object, index, value); }
+
+		UINT32 getArraySize(ObjectType* object) { return (mInterface->*mSizeGetter)(object); }
+		void setArraySize(ObjectType* object, UINT32 size) { (mInterface->*mSizeSetter)(object, size); }
+		bool hasArraySizeSetter() const { return mSizeSetter != nullptr; }
+
+	private:
+		InterfaceType* mInterface;
+		Getter mGetter;
+		Setter mSetter;
+		ArrayGetter mArrayGetter;
+		ArraySetter mArraySetter;
+		SizeGetter mSizeGetter;
+		SizeSetter mSizeSetter;
+	};
+
+	/**
+	 * @brief	Provides direct access to a data member of the object, without any getter/setter methods.
+	 * 			Only supports fields containing a single value.
+	 *
+	 * @see		RTTIPlainField
 	 */
 	template <class DataType, class ObjectType>
+	struct RTTIPlainMemberAccessor
+	{
+		RTTIPlainMemberAccessor()
+			:mMember(nullptr)
+		{ }
+
+		/**
+		 * @brief	Initializes the accessor with a pointer to the data member to access.
+		 */
+		void initSingle(DataType ObjectType::* member)
+		{
+			mMember = member;
+		}
+
+		DataType& getValue(ObjectType* object) { return object->*mMember; }
+		void setValue(ObjectType* object, DataType& value) { object->*mMember = value; }
+		bool hasSetter() const { return true; }
+
+		DataType& getArrayValue(ObjectType* object, UINT32 index) { BS_EXCEPT(InternalErrorException, "Member fields cannot be arrays."); }
+		void setArrayValue(ObjectType* object, UINT32 index, DataType& value) { BS_EXCEPT(InternalErrorException, "Member fields cannot be arrays."); }
+
+		UINT32 getArraySize(ObjectType* object) { BS_EXCEPT(InternalErrorException, "Member fields cannot be arrays."); }
+		void setArraySize(ObjectType* object, UINT32 size) { BS_EXCEPT(InternalErrorException, "Member fields cannot be arrays."); }
+		bool hasArraySizeSetter() const { return false; }
+
+	private:
+		DataType ObjectType::* mMember;
+	};
+
+	/**
+	 * @brief	Represents a plain class field containing a specific type.
+	 *
+	 * @note	Field values are read and written through "Accessor", which determines how the field was registered
+	 *			(e.g. type erased functions, RTTI type methods, or a direct data member). Accessor type is known
+	 *			at compile time so value access doesn't go through any additional type erasure.
+	 */
+	template <class DataType, class ObjectType, class Accessor = RTTIPlainFunctionAccessor<DataType, ObjectType>>
 	struct RTTIPlainField : public RTTIPlainFieldBase
 	{
 		/**
@@ -117,15 +288,28 @@ namespace BansheeEngine
 		 */
 		void initSingle(const String& name, UINT16 uniqueId, Any getter, Any setter, UINT64 flags)
 		{
-			int typeId = RTTIPlainType<DataType>::id; // Just making sure provided type has a type ID
-
-			static_assert((RTTIPlainType<DataType>::hasDynamicSize != 0 || (sizeof(DataType) <= 255)), 
-				"Trying to create a plain RTTI field with size larger than 255. In order to use larger sizes for plain types please specialize " \
-				" RTTIPlainType, set hasDynamicSize to true.");
+			checkDataType();
 
+			mAccessor.init(getter, setter, Any(), Any(), false);
 			initAll(getter, setter, nullptr, nullptr, name, uniqueId, false, SerializableFT_Plain, flags);
 		}
 
+		/**
+		 * @brief	Initializes a plain field containing a single value, using an already initialized accessor.
+		 *
+		 * @param	name		Name of the field.
+		 * @param	uniqueId	Unique identifier for this field.
+		 * @param	accessor	Accessor used for reading and writing the field value.
+		 * @param	flags		Various flags you can use to specialize how outside systems handle this field. See "RTTIFieldFlag".
+		 */
+		void initSingle(const String& name, UINT16 uniqueId, const Accessor& accessor, UINT64 flags)
+		{
+			checkDataType();
+
+			mAccessor = accessor;
+			initAll(Any(), Any(), Any(), Any(), name, uniqueId, false, SerializableFT_Plain, flags);
+		}
+
 		/**
 		 * @brief	Initializes a plain field containing multiple values in an array. 
 		 *
@@ -143,15 +327,30 @@ namespace BansheeEngine
 		void initArray(const String& name, UINT16 uniqueId, Any getter,
 			Any getSize, Any setter, Any setSize, UINT64 flags)
 		{
-			int typeId = RTTIPlainType<DataType>::id; // Just making sure provided type has a type ID
-
-			static_assert((RTTIPlainType<DataType>::hasDynamicSize != 0 || (sizeof(DataType) <= 255)), 
-				"Trying to create a plain RTTI field with size larger than 255. In order to use larger sizes for plain types please specialize " \
-				" RTTIPlainType, set hasDynamicSize to true.");
+			checkDataType();
+			checkContiguous(flags);
 
+			mAccessor.init(getter, setter, getSize, setSize, true);
 			initAll(getter, setter, getSize, setSize, name, uniqueId, true, SerializableFT_Plain, flags);
 		}
 
+		/**
+		 * @brief	Initializes a plain field containing multiple values in an array, using an already initialized accessor.
+		 *
+		 * @param	name		Name of the field.
+		 * @param	uniqueId	Unique identifier for this field.
+		 * @param	accessor	Accessor used for reading and writing the array elements and size.
+		 * @param	flags		Various flags you can use to specialize how outside systems handle this field. See "RTTIFieldFlag".
+		 */
+		void initArray(const String& name, UINT16 uniqueId, const Accessor& accessor, UINT64 flags)
+		{
+			checkDataType();
+			checkContiguous(flags);
+
+			mAccessor = accessor;
+			initAll(Any(), Any(), Any(), Any(), name, uniqueId, true, SerializableFT_Plain, flags);
+		}
+
 		/**
 		 * @copydoc RTTIField::getTypeSize
 		 */
@@ -185,11 +384,7 @@ namespace BansheeEngine
 			checkType<DataType>();
 
 			ObjectType* castObject = static_cast<ObjectType*>(object);
-
-			std::function<DataType&(ObjectType*)> f = any_cast<std::function<DataType&(ObjectType*)>>(valueGetter);
-			DataType value = f(castObject);
-
-			return RTTIPlainType<DataType>::getDynamicSize(value);
+			return RTTIPlainType<DataType>::getDynamicSize(mAccessor.getValue(castObject));
 		}
 
 		/**
@@ -201,11 +396,7 @@ namespace BansheeEngine
 			checkType<DataType>();
 
 			ObjectType* castObject = static_cast<ObjectType*>(object);
-
-			std::function<DataType&(ObjectType*, UINT32)> f = any_cast<std::function<DataType&(ObjectType*, UINT32)>>(valueGetter);
-			DataType value = f(castObject, index);
-
-			return RTTIPlainType<DataType>::getDynamicSize(value);
+			return RTTIPlainType<DataType>::getDynamicSize(mAccessor.getArrayValue(castObject, index));
 		}
 
 		/**
@@ -215,9 +406,8 @@ namespace BansheeEngine
 		{
 			checkIsArray(true);
 
-			std::function<UINT32(ObjectType*)> f = any_cast<std::function<UINT32(ObjectType*)>>(arraySizeGetter);
 			ObjectType* castObject = static_cast<ObjectType*>(object);
-			return f(castObject);
+			return mAccessor.getArraySize(castObject);
 		}
 
 		/**
@@ -227,15 +417,28 @@ namespace BansheeEngine
 		{
 			checkIsArray(true);
 
-			if(arraySizeSetter.empty())
+			if(!mAccessor.hasArraySizeSetter())
 			{
 				BS_EXCEPT(InternalErrorException, 
 					"Specified field (" + mName + ") has no array size setter.");
 			}
 
-			std::function<void(ObjectType*, UINT32)> f = any_cast<std::function<void(ObjectType*, UINT32)>>(arraySizeSetter);
 			ObjectType* castObject = static_cast<ObjectType*>(object);
-			f(castObject, size);
+			mAccessor.setArraySize(castObject, size);
+		}
+
+		/**
+		 * @copydoc RTTIPlainFieldBase::getArrayData
+		 */
+		virtual UINT8* getArrayData(void* object)
+		{
+			checkIsArray(true);
+
+			if((mFlags & RTTI_Flag_ContiguousArray) == 0)
+				return nullptr;
+
+			ObjectType* castObject = static_cast<ObjectType*>(object);
+			return (UINT8*)&mAccessor.getArrayValue(castObject, 0);
 		}
 
 		/**
@@ -247,11 +450,7 @@ namespace BansheeEngine
 			checkType<DataType>();
 
 			ObjectType* castObject = static_cast<ObjectType*>(object);
-
-			std::function<DataType&(ObjectType*)> f = any_cast<std::function<DataType&(ObjectType*)>>(valueGetter);
-			DataType value = f(castObject);
-
-			RTTIPlainType<DataType>::toMemory(value, (char*)buffer);
+			RTTIPlainType<DataType>::toMemory(mAccessor.getValue(castObject), (char*)buffer);
 		}
 
 		/**
@@ -263,11 +462,7 @@ namespace BansheeEngine
 			checkType<DataType>();
 
 			ObjectType* castObject = static_cast<ObjectType*>(object);
-
-			std::function<DataType&(ObjectType*, UINT32)> f = any_cast<std::function<DataType&(ObjectType*, UINT32)>>(valueGetter);
-			DataType value = f(castObject, index);
-
-			RTTIPlainType<DataType>::toMemory(value, (char*)buffer);
+			RTTIPlainType<DataType>::toMemory(mAccessor.getArrayValue(castObject, index), (char*)buffer);
 		}
 
 		/**
@@ -283,14 +478,13 @@ namespace BansheeEngine
 			DataType value;
 			RTTIPlainType<DataType>::fromMemory(value, (char*)buffer);
 
-			if(valueSetter.empty())
+			if(!mAccessor.hasSetter())
 			{
 				BS_EXCEPT(InternalErrorException,
 					"Specified field (" + mName + ") has no setter.");
 			}
 
-			std::function<void(ObjectType*, DataType&)> f = any_cast<std::function<void(ObjectType*, DataType&)>>(valueSetter);
-			f(castObject, value);
+			mAccessor.setValue(castObject, value);
 		}
 
 		/**
@@ -306,14 +500,44 @@ namespace BansheeEngine
 			DataType value;
 			RTTIPlainType<DataType>::fromMemory(value, (char*)buffer);
 
-			if(valueSetter.empty())
+			if(!mAccessor.hasSetter())
 			{
 				BS_EXCEPT(InternalErrorException, 
 					"Specified field (" + mName + ") has no setter.");
 			}
 
-			std::function<void(ObjectType*, UINT32, DataType&)> f = any_cast<std::function<void(ObjectType*, UINT32, DataType&)>>(valueSetter);
-			f(castObject, index, value);
+			mAccessor.setArrayValue(castObject, index, value);
 		}
+
+	private:
+		/**
+		 * @brief	Performs compile time checks on the data type of the field.
+		 */
+		void checkDataType()
+		{
+			int typeId = RTTIPlainType<DataType>::id; // Just making sure provided type has a type ID
+
+			static_assert((RTTIPlainType<DataType>::hasDynamicSize != 0 || (sizeof(DataType) <= 255)), 
+				"Trying to create a plain RTTI field with size larger than 255. In order to use larger sizes for plain types please specialize " \
+				" RTTIPlainType, set hasDynamicSize to true.");
+		}
+
+		/**
+		 * @brief	Throws an exception if the field is flagged as a contiguous array, but its data type
+		 * 			cannot be copied as a contiguous block.
+		 */
+		void checkContiguous(UINT64 flags)
+		{
+			if((flags & RTTI_Flag_ContiguousArray) == 0)
+				return;
+
+			if(RTTIPlainType<DataType>::hasDynamicSize != 0 || !std::is_trivially_copyable<DataType>::value)
+			{
+				BS_EXCEPT(InternalErrorException, 
+					"Contiguous array flag can only be used with plain types that have a static size and can be copied with memcpy.");
+			}
+		}
+
+		Accessor mAccessor;
 	};
 }
\ No newline at end of file
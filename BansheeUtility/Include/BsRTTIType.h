@@ -25,6 +25,20 @@ namespace BansheeEngine
 #define BS_ADD_PLAINFIELD(name, id, parentType) \
 	addPlainField(#name, id##, &##parentType##::get##name, &##parentType##::Set##name);
 
+	/**
+	 * @brief	Base class for user provided data shared between RTTI callbacks of all objects encoded in a single
+	 *			serialization operation (e.g. for collecting information about the encoded objects). Serializers pass
+	 *			it to RTTITypeBase::onSerializationStarted and RTTITypeBase::onSerializationEnded.
+	 *
+	 * @note	When encoding in parallel callbacks of different objects are called from multiple threads at once, 
+	 *			so implementations must be thread safe.
+	 */
+	class BS_UTILITY_EXPORT SerializationContext
+	{
+	public:
+		virtual ~SerializationContext() {}
+	};
+
 	/**
 	 * @brief	Provides an interface for accessing fields of a certain class.
 	 * 			Data can be easily accessed by getter and setter methods.
@@ -82,6 +96,13 @@ namespace BansheeEngine
 		 */
 		virtual void onSerializationStarted(IReflectable* obj) {}
 
+		/**
+		 * @copydoc	onSerializationStarted(IReflectable*)
+		 *
+		 * @param	context	Context provided to the serializer by the caller, if any. Can be null.
+		 */
+		virtual void onSerializationStarted(IReflectable* obj, SerializationContext* context) { onSerializationStarted(obj); }
+
 		/**
 		 * @brief	Called by the serializers when serialization for this object has ended.
 		 *			After serialization has ended you can be sure that the type has been fully serialized,
@@ -89,6 +110,13 @@ namespace BansheeEngine
 		 */
 		virtual void onSerializationEnded(IReflectable* obj) {}
 
+		/**
+		 * @copydoc	onSerializationEnded(IReflectable*)
+		 *
+		 * @param	context	Context provided to the serializer by the caller, if any. Can be null.
+		 */
+		virtual void onSerializationEnded(IReflectable* obj, SerializationContext* context) { onSerializationEnded(obj); }
+
 		/**
 		 * @brief	Called by the serializers when deserialization for this object has started.
 		 *			Use this to do any preprocessing on data you might need during deserialization itself.
@@ -479,7 +507,14 @@ namespace BansheeEngine
 		void throwCircularRefException(const String& myType, const String& otherType) const;
 
 	private:
+		friend class IReflectable;
+
 		Vector<RTTIField*> mFields;
+
+		// Range of pre-order indices of this type and all types deriving from it, in the RTTI hierarchy,
+		// packed together with the generation of the rebuild that assigned it. Assigned by IReflectable,
+		// 0 if not yet assigned.
+		std::atomic<UINT64> mHierarchyRange;
 	};
 
 	/**
@@ -592,13 +627,7 @@ namespace BansheeEngine
 		 */
 		virtual void _registerDerivedClass(RTTITypeBase* derivedClass)
 		{
-			if(IReflectable::_isTypeIdDuplicate(derivedClass->getRTTIId()))
-			{
-				BS_EXCEPT(InternalErrorException, "RTTI type \"" + derivedClass->getRTTIName() + 
-					"\" has a duplicate ID: " + toString(derivedClass->getRTTIId()));
-			}
-
-			getDerivedClasses().push_back(derivedClass);
+			IReflectable::_registerRTTIType(derivedClass, this);
 		}
 
 		/************************************************************************/
@@ -627,6 +656,39 @@ namespace BansheeEngine
 				std::function<void(ObjectType*, DataType&)>(setter), flags);
 		}
 
+		/**
+		 * @brief	Registers a new plain field that directly accesses a data member of the object. This field can then 
+		 *			be accessed dynamically from the RTTI system and used for automatic serialization. See RTTIField for 
+		 *			more information about field types.
+		 *
+		 * @param	name		Name of the field.
+		 * @param	uniqueId	Unique identifier for this field. Although name is also a unique
+		 * 						identifier we want a small data type that can be used for efficiently
+		 * 						serializing data to disk and similar. It is primarily used for compatibility
+		 * 						between different versions of serialized data.
+		 * @param	member		Pointer to the data member holding the value of the field.
+		 * @param	flags		Various flags you can use to specialize how systems handle this field. See RTTIFieldFlag.
+		 *
+		 * @note	Fastest way of registering a plain field, as values are accessed without calling any methods. Use when
+		 * 			no custom logic is required when getting or setting the value.
+		 */
+		template<class ObjectType, class DataType>
+		void addPlainField(const String& name, UINT32 uniqueId, DataType ObjectType::* member, UINT64 flags = 0)
+		{
+			static_assert(!(std::is_base_of<BansheeEngine::IReflectable, DataType>::value), 
+				"Data type derives from IReflectable but it is being added as a plain field.");
+
+			typedef RTTIPlainMemberAccessor<DataType, ObjectType> AccessorType;
+
+			AccessorType accessor;
+			accessor.initSingle(member);
+
+			RTTIPlainField<DataType, ObjectType, AccessorType>* newField = 
+				bs_new<RTTIPlainField<DataType, ObjectType, AccessorType>>();
+			newField->initSingle(name, uniqueId, accessor, flags);
+			addNewField(newField);
+		}
+
 		/**
 		 * @brief	Registers a new reflectable object field. This field can then be accessed dynamically from the RTTI system and
 		 *			used for automatic serialization. See RTTIField for more information about field types.
@@ -785,17 +847,21 @@ namespace BansheeEngine
 			DataType& (InterfaceType::*getter)(ObjectType*), 
 			void (InterfaceType::*setter)(ObjectType*, DataType&), UINT64 flags = 0)
 		{
-			using namespace std::placeholders;
-
 			static_assert((std::is_base_of<BansheeEngine::RTTIType<Type, BaseType, MyRTTIType>, InterfaceType>::value), 
 				"Class with the get/set methods must derive from BansheeEngine::RTTIType.");
 
 			static_assert(!(std::is_base_of<BansheeEngine::IReflectable, DataType>::value), 
 				"Data type derives from IReflectable but it is being added as a plain field.");
 
-			addPlainField<ObjectType, DataType>(name, uniqueId, 
-				std::function<DataType&(ObjectType*)>(std::bind(getter, static_cast<InterfaceType*>(this), _1)), 
-				std::function<void(ObjectType*, DataType&)>(std::bind(setter, static_cast<InterfaceType*>(this), _1, _2)), flags);
+			typedef RTTIPlainInterfaceAccessor<DataType, ObjectType, InterfaceType> AccessorType;
+
+			AccessorType accessor;
+			accessor.initSingle(static_cast<InterfaceType*>(this), getter, setter);
+
+			RTTIPlainField<DataType, ObjectType, AccessorType>* newField = 
+				bs_new<RTTIPlainField<DataType, ObjectType, AccessorType>>();
+			newField->initSingle(name, uniqueId, accessor, flags);
+			addNewField(newField);
 		}
 
 		template<class InterfaceType, class ObjectType, class DataType>
@@ -829,19 +895,21 @@ namespace BansheeEngine
 			void (InterfaceType::*setter)(ObjectType*, UINT32, DataType&), 
 			void(InterfaceType::*setSize)(ObjectType*, UINT32), UINT64 flags = 0)
 		{
-			using namespace std::placeholders;
-
 			static_assert((std::is_base_of<BansheeEngine::RTTIType<Type, BaseType, MyRTTIType>, InterfaceType>::value), 
 				"Class with the get/set methods must derive from BansheeEngine::RTTIType.");
 
 			static_assert(!(std::is_base_of<BansheeEngine::IReflectable, DataType>::value), 
 				"Data type derives from IReflectable but it is being added as a plain field.");
 
-			addPlainArrayField<ObjectType, DataType>(name, uniqueId, 
-				std::function<DataType&(ObjectType*, UINT32)>(std::bind(getter, static_cast<InterfaceType*>(this), _1, _2)), 
-				std::function<UINT32(ObjectType*)>(std::bind(getSize, static_cast<InterfaceType*>(this), _1)), 
-				std::function<void(ObjectType*, UINT32, DataType&)>(std::bind(setter, static_cast<InterfaceType*>(this), _1, _2, _3)), 
-				std::function<void(ObjectType*, UINT32)>(std::bind(setSize, static_cast<InterfaceType*>(this), _1, _2)), flags);
+			typedef RTTIPlainInterfaceAccessor<DataType, ObjectType, InterfaceType> AccessorType;
+
+			AccessorType accessor;
+			accessor.initArray(static_cast<InterfaceType*>(this), getter, getSize, setter, setSize);
+
+			RTTIPlainField<DataType, ObjectType, AccessorType>* newField = 
+				bs_new<RTTIPlainField<DataType, ObjectType, AccessorType>>();
+			newField->initArray(name, uniqueId, accessor, flags);
+			addNewField(newField);
 		}	
 
 		template<class InterfaceType, class ObjectType, class DataType>
@@ -0,0 +1,152 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsThreadDefines.h"
+
+namespace BansheeEngine
+{
+	struct ScratchArena;
+
+	/**
+	 * @brief	Per-thread bump allocator used for temporary allocations. Allocations are placed one after another
+	 * 			in large pages, and are released all at once when the enclosing ScratchScope ends. Pages are kept
+	 * 			around after the scope ends so later temporaries can reuse them.
+	 *
+	 * @note	Memory is only bump allocated while a ScratchScope is active on the calling thread. Outside of a scope
+	 * 			allocations are forwarded to the OS allocator, so code using ScratchAlloc works regardless
+	 * 			of whether a scope was set up by the caller.
+	 *
+	 *			Freeing a bump allocation is only required in order to keep the code symmetric with the heap
+	 *			path. Deallocations don't need to happen in any specific order, but memory is only reused immediately
+	 *			if the most recent allocation is freed. Everything else is reclaimed when the scope ends.
+	 *
+	 *			Thread safe, as each thread uses its own pages. Memory allocated within a scope must not be
+	 *			used after the scope ends.
+	 */
+	class ScratchAllocator
+	{
+	public:
+		/**
+		 * @brief	Allocates the specified number of bytes.
+		 *
+		 * @param	bytes		Number of bytes to allocate.
+		 * @param	alignment	Alignment of the returned memory, in bytes. Must be a power of two. Memory
+		 * 						is always at least 16 byte aligned.
+		 */
+		static BS_UTILITY_EXPORT void* allocate(size_t bytes, UINT32 alignment = 16);
+
+		/**
+		 * @brief	Frees memory previously allocated with allocate().
+		 */
+		static BS_UTILITY_EXPORT void free(void* ptr);
+
+		/**
+		 * @brief	Frees all pages owned by the calling thread. Must not be called while
+		 * 			a ScratchScope is active on the thread.
+		 */
+		static BS_UTILITY_EXPORT void releaseThreadMemory();
+
+	private:
+		friend class ScratchScope;
+
+		/**
+		 * @brief	Allocates the specified number of bytes from the OS allocator.
+		 */
+		static void* allocateHeap(size_t bytes, UINT32 alignment);
+
+		/**
+		 * @brief	Returns the arena for the calling thread, creating it if needed.
+		 */
+		static ScratchArena* getArena();
+
+		static BS_THREADLOCAL ScratchArena* ActiveArena;
+	};
+
+	/**
+	 * @brief	Begins a scratch allocation scope on the current thread when constructed, and ends it
+	 * 			when destructed. All ScratchAlloc allocations made by the thread while the scope is active
+	 * 			are released when the scope ends. Scopes can be nested.
+	 */
+	class BS_UTILITY_EXPORT ScratchScope
+	{
+	public:
+		ScratchScope();
+		~ScratchScope();
+
+	private:
+		ScratchScope(const ScratchScope&);
+		ScratchScope& operator=(const ScratchScope&);
+
+		friend class ScratchAllocator;
+
+		ScratchScope* mParent;
+		UINT32 mPageIdx;
+		size_t mPageOffset;
+		void* mLastAllocation;
+	};
+
+	/**
+	 * @brief	Specialized memory allocator implementation that uses the per-thread scratch
+	 * 			allocator for the ScratchAlloc category.
+	 *
+	 * @see		ScratchAllocator
+	 */
+	template<>
+	class MemoryAllocator<ScratchAlloc> : public MemoryAllocatorBase
+	{
+	public:
+		static inline void* allocate(size_t bytes)
+		{
+#if BS_PROFILING_ENABLED
+			incAllocCount();
+#endif
+
+#if BS_MEMORY_TRACKING_ENABLED
+			return MemoryTracker::trackAlloc(ScratchAllocator::allocate(bytes + MemoryTracker::HEADER_SIZE), bytes, MemoryCategory::Scratch);
+#else
+			return ScratchAllocator::allocate(bytes);
+#endif
+		}
+
+		static inline void* allocateArray(size_t bytes, UINT32 count)
+		{
+#if BS_PROFILING_ENABLED
+			incAllocCount();
+#endif
+
+#if BS_MEMORY_TRACKING_ENABLED
+			return MemoryTracker::trackAlloc(ScratchAllocator::allocate(bytes * count + MemoryTracker::HEADER_SIZE), bytes * count, MemoryCategory::Scratch);
+#else
+			return ScratchAllocator::allocate(bytes * count);
+#endif
+		}
+
+		static inline void free(void* ptr)
+		{
+#if BS_PROFILING_ENABLED
+			incFreeCount();
+#endif
+
+#if BS_MEMORY_TRACKING_ENABLED
+			ScratchAllocator::free(MemoryTracker::trackFree(ptr, MemoryCategory::Scratch));
+#else
+			ScratchAllocator::free(ptr);
+#endif
+		}
+
+		static inline void freeArray(void* ptr, UINT32 count)
+		{
+#if BS_PROFILING_ENABLED
+			incFreeCount();
+#endif
+
+#if BS_MEMORY_TRACKING_ENABLED
+			ScratchAllocator::free(MemoryTracker::trackFree(ptr, MemoryCategory::Scratch));
+#else
+			ScratchAllocator::free(ptr);
+#endif
+		}
+	};
+}
\ No newline at end of file
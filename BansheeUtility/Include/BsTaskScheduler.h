@@ -6,6 +6,7 @@
 #include "BsPrerequisitesUtil.h"
 #include "BsModule.h"
 #include "BsThreadPool.h"
+#include "BsSpinLock.h"
 
 namespace BansheeEngine
 {
@@ -25,6 +26,10 @@ namespace BansheeEngine
 	 * @brief	Represents a single task that may be queued in the TaskScheduler.
 	 * 			
 	 * @note	Thread safe.
+	 *
+	 *			Tasks may depend on any number of other tasks, and any number of tasks may depend on a single task.
+	 *			This allows you to build task graphs. A task is only queued for execution once all of its dependencies
+	 *			complete. If any of its dependencies are canceled the task is canceled as well.
 	 */
 	class BS_UTILITY_EXPORT Task
 	{
@@ -32,7 +37,7 @@ namespace BansheeEngine
 
 	public:
 		Task(const PrivatelyConstruct& dummy, const String& name, std::function<void()> taskWorker, 
-			TaskPriority priority, TaskPtr dependency);
+			TaskPriority priority, const Vector<TaskPtr>& dependencies);
 
 		/**
 		 * @brief	Creates a new task. Task should be provided to TaskScheduler in order for it
@@ -47,6 +52,32 @@ namespace BansheeEngine
 		static TaskPtr create(const String& name, std::function<void()> taskWorker, TaskPriority priority = TaskPriority::Normal, 
 			TaskPtr dependency = nullptr);
 
+		/**
+		 * @brief	Creates a new task with multiple dependencies. Task should be provided to TaskScheduler 
+		 *			in order for it to start.
+		 *
+		 * @param	name			Name you can use to more easily identify the task.
+		 * @param	taskWorker		Worker method that does all of the work in the task. Can be null, in which
+		 *							case the task just serves as a join point for its dependencies.
+		 * @param	priority  		Higher priority means the tasks will be executed sooner.
+		 * @param	dependencies	Tasks that must complete before this task is executed. Dependencies
+		 *							must be queued in the TaskScheduler in order for them to ever complete.
+		 */
+		static TaskPtr create(const String& name, std::function<void()> taskWorker, TaskPriority priority, 
+			const Vector<TaskPtr>& dependencies);
+
+		/**
+		 * @brief	Creates a continuation task that will be executed after this task completes, and
+		 *			queues it in the TaskScheduler.
+		 *
+		 * @param	name		Name you can use to more easily identify the task.
+		 * @param	taskWorker	Worker method that does all of the work in the task.
+		 * @param	priority  	(optional) Higher priority means the tasks will be executed sooner.
+		 *
+		 * @returns	The continuation task, which may itself be continued or used as a dependency.
+		 */
+		TaskPtr then(const String& name, std::function<void()> taskWorker, TaskPriority priority = TaskPriority::Normal);
+
 		/**
 		 * @brief	Returns true if the task has completed.
 		 */
@@ -60,25 +91,46 @@ namespace BansheeEngine
 		/**
 		 * @brief	Blocks the current thread until the task has completed. 
 		 * 			
-		 * @note	While waiting adds a new worker thread, so that the blocking threads core can be utilized.
+		 * @note	If called from a worker thread, the worker will execute other queued tasks while waiting.
+		 *			Other threads just block. Either way, if the thread has to block a new worker is added in
+		 *			the meantime, so that the blocking threads core can be utilized.
+		 *			
+		 *			If the task was canceled this returns once the cancellation has been propagated to all of
+		 *			its successors.
 		 */
 		void wait();
 
 		/**
-		 * @brief	Cancels the task and removes it from the TaskSchedulers queue.
+		 * @brief	Cancels the task and removes it from the TaskSchedulers queue. Any tasks depending
+		 *			on this task will be canceled as well.
 		 */
 		void cancel();
 
 	private:
 		friend class TaskScheduler;
 
+		/**
+		 * @brief	Registers a task that will have its dependency counter decremented when
+		 *			this task finishes.
+		 *
+		 * @returns	False if this task has already finished, in which case the successor was not registered.
+		 */
+		bool addSuccessor(const TaskPtr& task);
+
 		String mName;
 		TaskPriority mPriority;
 		UINT32 mTaskId;
 		std::function<void()> mTaskWorker;
-		TaskPtr mTaskDependency;
 		std::atomic<UINT32> mState; /**< 0 - Inactive, 1 - In progress, 2 - Completed, 3 - Canceled */
 
+		Vector<TaskPtr> mDependencies;
+		Vector<TaskPtr> mSuccessors;
+		std::atomic<UINT32> mNumPendingDependencies;
+		bool mIsFinished;
+		std::atomic<bool> mIsResolved; /**< True once the task finished and all of its successors were notified. */
+		SpinLock mSuccessorLock;
+
+		std::weak_ptr<Task> mThis;
 		TaskScheduler* mParent;
 	};
 
@@ -89,15 +141,45 @@ namespace BansheeEngine
 	 * 			
 	 * @note	Thread safe.
 	 * 			
-	 *			This type of task scheduler uses a global queue and is best used for coarse granularity of tasks.
-	 *			(Number of tasks in the order of hundreds. Higher number of tasks might require different queuing and
-	 *			locking mechanism, potentially at the cost of flexibility.)
+	 *			Each worker thread owns its own task queue. Tasks queued from a worker thread are placed in that
+	 *			workers queue, while tasks queued from other threads are distributed between worker queues. Workers
+	 *			execute tasks from their own queue first and steal tasks from other workers when their queue runs
+	 *			empty. Task priority is respected within a single worker queue, but not globally across all workers.
 	 *			
-	 *			By default the task scheduler will create as many threads as there are physical CPU cores. You may add or remove
-	 *			threads using addWorker/removeWorker methods.
+	 *			Tasks with dependencies are not placed in a queue until their last dependency completes, at which
+	 *			point the thread that completed the dependency queues them.
+	 *			
+	 *			By default the task scheduler will allow as many workers as there are logical CPU cores. You may add or remove
+	 *			workers using addWorker/removeWorker methods. Worker threads are created on demand and are kept alive
+	 *			until the scheduler is shut down. Tasks still queued when the scheduler is shut down are canceled.
 	 */
 	class BS_UTILITY_EXPORT TaskScheduler : public Module<TaskScheduler>
 	{
+		/**
+		 * @brief	Number of different task priorities, starting at TaskPriority::VeryLow.
+		 */
+		static const UINT32 NUM_PRIORITIES = 5;
+
+		/**
+		 * @brief	Maximum number of nested waits during which a worker thread will execute other tasks. Each
+		 *			executed task may wait on another task itself, so this limits the stack depth of a worker.
+		 */
+		static const UINT32 MAX_NESTED_WAITS = 4;
+
+		/**
+		 * @brief	Task queue owned by a single worker thread. Owner pushes and pops tasks
+		 *			from the back, while other threads steal tasks from the front.
+		 */
+		struct TaskWorker
+		{
+			TaskWorker(UINT32 index);
+
+			Deque<TaskPtr> queues[NUM_PRIORITIES];
+			SpinLock lock;
+			UINT32 index;
+			HThread thread;
+		};
+
 	public:
 		TaskScheduler();
 		~TaskScheduler();
@@ -117,41 +199,121 @@ namespace BansheeEngine
 		 */
 		void removeWorker();
 
+		/**
+		 * @brief	Returns the number of workers that are allowed to execute tasks at once.
+		 */
+		UINT32 getNumWorkers() const;
+
+		/**
+		 * @brief	Returns the maximum number of worker threads the scheduler will ever create. Each worker
+		 *			permanently occupies a ThreadPool thread once created, so the thread pool must be able
+		 *			to provide at least this many threads.
+		 */
+		static UINT32 getMaxNumWorkers();
+
 	protected:
 		friend class Task;
 
 		/**
-		 * @brief	Main task scheduler method that dispatches tasks to other threads.
+		 * @brief	Main worker method that executes tasks from the workers queue, or from other workers
+		 *			queues when its own queue is empty.
 		 */
-		void runMain();
+		void runWorker(TaskWorker* worker);
 
 		/**
-		 * @brief	Worker method that runs a single task.
+		 * @brief	Executes a single task and notifies anyone waiting on it.
 		 */
-		void runTask(TaskPtr task);
+		void runTask(const TaskPtr& task);
 
 		/**
-		 * @brief	Blocks the calling thread until the specified task has completed.
+		 * @brief	Marks the task as finished (either completed or canceled) and queues any
+		 *			of its successors that no longer have any pending dependencies.
 		 */
-		void waitUntilComplete(const Task* task);
+		void finishTask(const TaskPtr& task);
 
 		/**
-		 * @brief	Method used for sorting tasks.
+		 * @brief	Inserts a task with no pending dependencies into one of the worker queues.
 		 */
-		static bool taskCompare(const TaskPtr& lhs, const TaskPtr& rhs);
+		void queueReadyTask(const TaskPtr& task);
+
+		/**
+		 * @brief	Attempts to find a queued task and executes it on the calling thread.
+		 *
+		 * @returns	True if a task was executed, false if no task was ready.
+		 */
+		bool tryRunTask();
+
+		/**
+		 * @brief	Finds a task ready for execution, first by searching the provided worker queue
+		 *			(if any), and then by stealing from other worker queues.
+		 *
+		 * @param	worker	Worker whose queue to search first. Can be null.
+		 * @param	task	Output task, if one was found.
+		 *
+		 * @returns	True if a task was found.
+		 */
+		bool findTask(TaskWorker* worker, TaskPtr& task);
+
+		/**
+		 * @brief	Removes a task from a worker queue. Higher priority tasks are removed first.
+		 *
+		 * @param	worker	Worker whose queue to remove the task from.
+		 * @param	steal	If true the task is removed from the front of the queue (oldest), otherwise from
+		 *					the back (newest).
+		 * @param	task	Output task, if one was found.
+		 *
+		 * @returns	True if a task was found.
+		 */
+		bool popTask(TaskWorker* worker, bool steal, TaskPtr& task);
+
+		/**
+		 * @brief	Inserts a task in the queue of the specified worker.
+		 */
+		void pushTask(TaskWorker* worker, const TaskPtr& task);
+
+		/**
+		 * @brief	Creates worker threads until their number matches the number of allowed active workers.
+		 */
+		void spawnWorkers();
+
+		/**
+		 * @brief	Returns index of the worker queue for tasks of the provided priority.
+		 */
+		static UINT32 getPriorityIdx(TaskPriority priority);
+
+		/**
+		 * @brief	Wakes up any threads waiting for a task to complete.
+		 */
+		void notifyTaskComplete();
+
+		/**
+		 * @brief	Blocks the calling thread until the specified task has finished (completed or canceled,
+		 *			and its successors notified).
+		 *			
+		 * @note	Worker threads execute other queued tasks while they wait, up to MAX_NESTED_WAITS nested
+		 *			waits deep. Other threads (e.g. main or core thread) never run queued tasks, as the task could
+		 *			block on them, or rely on thread local state of a worker.
+		 */
+		void waitUntilComplete(const Task* task);
+
+		Vector<TaskWorker*> mWorkers;
+		std::atomic<UINT32> mNumWorkers;
+		std::atomic<UINT32> mMaxActiveTasks;
+		std::atomic<UINT32> mNumQueuedTasks;
+		std::atomic<UINT32> mNumSleepingWorkers;
+		std::atomic<UINT32> mNumWaitingThreads;
+		std::atomic<UINT32> mNextWorker;
+		std::atomic<UINT32> mNextTaskId;
+		std::atomic<bool> mShutdown;
 
-		HThread mTaskSchedulerThread;
-		Set<TaskPtr, std::function<bool(const TaskPtr&, const TaskPtr&)>> mTaskQueue;
-		Vector<TaskPtr> mActiveTasks;
-		UINT32 mNumActiveTasks;
-		UINT32 mMaxActiveTasks;
-		UINT32 mNextTaskId;
-		bool mShutdown;
+		static BS_THREADLOCAL TaskWorker* ActiveWorker;
+		static BS_THREADLOCAL UINT32 ActiveWaitDepth;
 
 		BS_MUTEX(mReadyMutex);
 		BS_MUTEX(mCompleteMutex);
-		BS_MUTEX(mActiveTaskMutex);
+		BS_MUTEX(mWorkerMutex);
 		BS_THREAD_SYNCHRONISER(mTaskReadyCond);
+		BS_THREAD_SYNCHRONISER(mWorkerActiveCond);
 		BS_THREAD_SYNCHRONISER(mTaskCompleteCond);
 	};
 }
\ No newline at end of file
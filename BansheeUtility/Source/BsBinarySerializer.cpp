@@ -12,8 +12,8 @@
 #include "BsRTTIReflectableField.h"
 #include "BsRTTIReflectablePtrField.h"
 #include "BsRTTIManagedDataBlockField.h"
-
-#include <unordered_set>
+#include "BsDataStream.h"
+#include "BsParallel.h"
 
 /**
  * @brief	A macro that represents a block of code that gets used a lot inside
@@ -41,66 +41,190 @@ buffer += size##;														\
 
 namespace BansheeEngine
 {
+	/**
+	 * @brief	Provides access to encoded data during decoding. Data is either read directly from memory, 
+	 * 			or from a stream through a window of limited size, so that the entire encoded data never needs 
+	 * 			to be loaded in memory at once. All offsets are relative to the start of the encoded data.
+	 */
+	class BinarySerializer::DecodeSource
+	{
+	public:
+		/**
+		 * @brief	Default size of the window used when reading from a stream, in bytes.
+		 */
+		static const UINT32 WINDOW_SIZE = 64 * 1024;
+
+		DecodeSource(UINT8* data, UINT64 dataLength, const std::shared_ptr<void>& dataOwner = nullptr)
+			:mDataOwner(dataOwner), mStreamStart(0), mLength(dataLength), mWindow(data), mWindowStart(0), 
+			mWindowSize(dataLength), mWindowCapacity(0)
+		{ }
+
+		DecodeSource(const DataStreamPtr& stream, UINT64 dataLength)
+			:mStream(stream), mStreamStart(stream->tell()), mLength(dataLength), mWindow(nullptr), 
+			mWindowStart(0), mWindowSize(0), mWindowCapacity(0)
+		{ }
+
+		~DecodeSource()
+		{
+			if(mWindowCapacity > 0)
+				bs_free(mWindow);
+		}
+
+		/**
+		 * @brief	Returns the total length of the encoded data, in bytes.
+		 */
+		UINT64 getLength() const { return mLength; }
+
+		/**
+		 * @brief	Returns the object owning the source memory, if data may be referenced in place.
+		 */
+		const std::shared_ptr<void>& getDataOwner() const { return mDataOwner; }
+
+		/**
+		 * @brief	Returns a pointer to "size" bytes of data starting at "offset". Returned pointer
+		 * 			is only valid until the next call to request or read.
+		 */
+		UINT8* request(UINT64 offset, UINT64 size)
+		{
+			if((offset + size) > mLength)
+			{
+				BS_EXCEPT(InternalErrorException, 
+					"Error decoding data.");
+			}
+
+			if(offset >= mWindowStart && (offset + size) <= (mWindowStart + mWindowSize))
+				return mWindow + (offset - mWindowStart);
+
+			// Only stream sources can get here, memory sources always have all the data in their window
+			if(size > mWindowCapacity)
+			{
+				if(mWindowCapacity > 0)
+					bs_free(mWindow);
+
+				mWindowCapacity = std::max((UINT64)WINDOW_SIZE, size);
+				mWindow = (UINT8*)bs_alloc((size_t)mWindowCapacity);
+			}
+
+			mWindowStart = offset;
+			mWindowSize = std::min(mWindowCapacity, mLength - offset);
+			readStream(offset, mWindow, mWindowSize);
+
+			return mWindow;
+		}
+
+		/**
+		 * @brief	Copies "size" bytes of data starting at "offset" into the provided buffer. Large
+		 * 			reads from streams bypass the window and are read directly into the buffer.
+		 */
+		void read(UINT64 offset, void* dest, UINT64 size)
+		{
+			if(mStream == nullptr || size <= WINDOW_SIZE)
+			{
+				memcpy(dest, request(offset, size), (size_t)size);
+				return;
+			}
+
+			if((offset + size) > mLength)
+			{
+				BS_EXCEPT(InternalErrorException, 
+					"Error decoding data.");
+			}
+
+			readStream(offset, dest, size);
+		}
+
+	private:
+		/**
+		 * @brief	Reads data from the stream. Throws an exception if not enough data could be read.
+		 */
+		void readStream(UINT64 offset, void* dest, UINT64 size)
+		{
+			mStream->seek((size_t)(mStreamStart + offset));
+			if(mStream->read(dest, (size_t)size) != size)
+			{
+				BS_EXCEPT(InternalErrorException, 
+					"Error decoding data. Unexpected end of stream.");
+			}
+		}
+
+		DataStreamPtr mStream;
+		std::shared_ptr<void> mDataOwner;
+		UINT64 mStreamStart;
+		UINT64 mLength;
+
+		UINT8* mWindow;
+		UINT64 mWindowStart;
+		UINT64 mWindowSize;
+		UINT64 mWindowCapacity;
+	};
+
 	BinarySerializer::BinarySerializer()
-		:mLastUsedObjectId(1)
+		:mLastUsedObjectId(1), mTotalBytesWritten(0), mContext(nullptr), mDeferReferences(false)
 	{
 	}
 
-	void BinarySerializer::encode(IReflectable* object, UINT8* buffer, UINT32 bufferLength, int* bytesWritten, std::function<UINT8*(UINT8*, int, UINT32&)> flushBufferCallback)
+	void BinarySerializer::encode(IReflectable* object, UINT8* buffer, UINT32 bufferLength, int* bytesWritten, 
+		std::function<UINT8*(UINT8*, int, UINT32&)> flushBufferCallback, bool parallel, SerializationContext* context)
 	{
 		mObjectsToEncode.clear();
 		mObjectAddrToId.clear();
 		mLastUsedObjectId = 1;
 		*bytesWritten = 0;
 		mTotalBytesWritten = 0;
+		mContext = context;
 		UINT8* bufferStart = buffer;
 
-		UINT32 objectId = findOrCreatePersistentId(object);
-		
-		// Encode primary object and its value types
-		buffer = encodeInternal(object, objectId, buffer, bufferLength, bytesWritten, flushBufferCallback);
-		if(buffer == nullptr)
+		if(parallel)
 		{
-			BS_EXCEPT(InternalErrorException, 
-				"Destination buffer is null or not large enough.");
+			buffer = encodeParallel(object, buffer, bufferLength, bytesWritten, flushBufferCallback);
+			if(buffer == nullptr)
+			{
+				BS_EXCEPT(InternalErrorException, 
+					"Destination buffer is null or not large enough.");
+			}
 		}
-
-		// Encode pointed to objects and their value types
-		UnorderedSet<UINT32> serializedObjects;
-		while(true)
+		else
 		{
-			auto iter = mObjectsToEncode.begin();
-			bool foundObjectToProcess = false;
-			for(iter; iter != mObjectsToEncode.end(); ++iter)
+			UINT32 objectId = findOrCreatePersistentId(object);
+
+			// Encode primary object and its value types
+			buffer = encodeInternal(object, objectId, buffer, bufferLength, bytesWritten, flushBufferCallback);
+			if(buffer == nullptr)
 			{
-				auto foundExisting = serializedObjects.find(iter->objectId);
-				if(foundExisting != serializedObjects.end())
+				BS_EXCEPT(InternalErrorException, 
+					"Destination buffer is null or not large enough.");
+			}
+
+			// Encode pointed to objects and their value types. Objects are processed in the order they were
+			// registered in. Encoding an object may register new ones, which get appended to the end of the queue.
+			Vector<bool> serializedObjects(mLastUsedObjectId, false);
+			for(UINT32 i = 0; i < (UINT32)mObjectsToEncode.size(); i++)
+			{
+				// Copy, as the queue might grow (and reallocate) during encoding
+				ObjectToEncode curObject = mObjectsToEncode[i];
+
+				if(curObject.objectId >= (UINT32)serializedObjects.size())
+					serializedObjects.resize(mLastUsedObjectId, false);
+
+				if(serializedObjects[curObject.objectId])
 					continue; // Already processed
 
-				std::shared_ptr<IReflectable> curObject = iter->object;
-				UINT32 curObjectid = iter->objectId;
-				serializedObjects.insert(curObjectid);
-				mObjectsToEncode.erase(iter);
+				serializedObjects[curObject.objectId] = true;
 
-				buffer = encodeInternal(curObject.get(), curObjectid, buffer, bufferLength, bytesWritten, flushBufferCallback);
+				buffer = encodeInternal(curObject.object.get(), curObject.objectId, buffer, bufferLength, bytesWritten, flushBufferCallback);
 				if(buffer == nullptr)
 				{
 					BS_EXCEPT(InternalErrorException, 
 						"Destination buffer is null or not large enough.");
 				}
-
-				foundObjectToProcess = true;
-				break; // Need to start over as mObjectsToSerialize was possibly modified
 			}
-
-			if(!foundObjectToProcess) // We're done
-				break;
 		}
 
-		// Final flush
+		// Final flush. No more space is needed, which is signaled by a zero buffer size.
 		if(*bytesWritten > 0)
 		{
 			mTotalBytesWritten += *bytesWritten;
+			bufferLength = 0;
 			buffer = flushBufferCallback(buffer - *bytesWritten, *bytesWritten, bufferLength);
 		}
 
@@ -108,21 +232,41 @@ namespace BansheeEngine
 
 		mObjectsToEncode.clear();
 		mObjectAddrToId.clear();
+		mContext = nullptr;
 	}
 
 	std::shared_ptr<IReflectable> BinarySerializer::decode(UINT8* data, UINT32 dataLength)
+	{
+		DecodeSource source(data, dataLength);
+		return decodeObjects(source);
+	}
+
+	std::shared_ptr<IReflectable> BinarySerializer::decode(const DataStreamPtr& stream, UINT64 dataLength)
+	{
+		DecodeSource source(stream, dataLength);
+		return decodeObjects(source);
+	}
+
+	std::shared_ptr<IReflectable> BinarySerializer::decode(UINT8* data, UINT64 dataLength, const std::shared_ptr<void>& dataOwner)
+	{
+		DecodeSource source(data, dataLength, dataOwner);
+		return decodeObjects(source);
+	}
+
+	std::shared_ptr<IReflectable> BinarySerializer::decodeObjects(DecodeSource& source)
 	{
 		mObjectMap.clear();
 
+		UINT64 dataLength = source.getLength();
+
 		// Create empty instances of all ptr objects
-		UINT32 bytesRead = 0;
-		UINT8* dataIter = nullptr;
+		UINT64 bytesRead = 0;
 		std::shared_ptr<IReflectable> rootObject = nullptr;
 		do 
 		{
-			dataIter = data + bytesRead;
+			UINT64 objectOffset = bytesRead;
 
-			if(sizeof(UINT32) > dataLength)
+			if((objectOffset + sizeof(ObjectMetaData)) > dataLength)
 			{
 				BS_EXCEPT(InternalErrorException, 
 					"Error decoding data.");
@@ -131,7 +275,7 @@ namespace BansheeEngine
 			ObjectMetaData objectMetaData;
 			objectMetaData.objectMeta = 0;
 			objectMetaData.typeId = 0;
-			memcpy(&objectMetaData, dataIter, sizeof(ObjectMetaData));
+			source.read(objectOffset, &objectMetaData, sizeof(ObjectMetaData));
 
 			UINT32 objectId = 0;
 			UINT32 objectTypeId = 0;
@@ -145,12 +289,12 @@ namespace BansheeEngine
 			}
 
 			std::shared_ptr<IReflectable> object = IReflectable::createInstanceFromTypeId(objectTypeId);
-			mObjectMap.insert(std::make_pair(objectId, ObjectToDecode(objectId, object, dataIter, bytesRead)));
+			mObjectMap.insert(std::make_pair(objectId, ObjectToDecode(objectId, object, objectOffset)));
 
 			if(rootObject == nullptr)
 				rootObject = object;
 
-		} while (decodeInternal(nullptr, dataIter, dataLength, bytesRead));
+		} while (decodeInternal(nullptr, source, dataLength, bytesRead));
 
 		// Now go through all of the objects and actually decode them
 		for(auto iter = mObjectMap.begin(); iter != mObjectMap.end(); ++iter)
@@ -160,8 +304,10 @@ namespace BansheeEngine
 			if(objToDecode.isDecoded)
 				continue;
 
-			UINT32 objectBytesRead = objToDecode.locationInFile;
-			decodeInternal(objToDecode.object, objToDecode.locationInBuffer, dataLength, objectBytesRead);
+			UINT64 objectBytesRead = objToDecode.locationInFile;
+			decodeInternal(objToDecode.object, source, dataLength, objectBytesRead);
+
+			objToDecode.isDecoded = true;
 		}
 
 		mObjectMap.clear();
@@ -175,6 +321,7 @@ namespace BansheeEngine
 		static const UINT32 META_SIZE = 4; // Meta field size
 		static const UINT32 NUM_ELEM_FIELD_SIZE = 4; // Size of the field storing number of array elements
 		static const UINT32 COMPLEX_TYPE_SIZE = 4; // Size of the field storing the size of a child complex type
+		static const UINT32 DATA_BLOCK_TYPE_FIELD_SIZE = 4; // Size of the field storing the size of a data block
 
 		RTTITypeBase* si = object->getRTTI();
 		bool isBaseClass = false;
@@ -182,7 +329,7 @@ namespace BansheeEngine
 		// If an object has base classes, we need to iterate through all of them
 		do
 		{
-			si->onSerializationStarted(object);
+			si->onSerializationStarted(object, mContext);
 
 			// Encode object ID & type
 			ObjectMetaData objectMetaData = encodeObjectMetaData(objectId, si->getRTTIId(), isBaseClass);
@@ -193,8 +340,25 @@ namespace BansheeEngine
 			{
 				RTTIField* curGenericField = si->getField(i);
 
+				// Data blocks that may be referenced in place are aligned. Padding is stored in place of the type size,
+				// which is otherwise unused for data blocks. Data within complex types serialized by value (ID == 0) is
+				// never aligned, as their size must be known before they are encoded.
+				UINT32 metaTypeSize = curGenericField->getTypeSize();
+				UINT32 dataBlockPadding = 0;
+				if(curGenericField->mType == SerializableFT_DataBlock && objectId != 0 && 
+					(curGenericField->getFlags() & RTTI_Flag_DataBlockView) != 0)
+				{
+					UINT32 dataOffset = mTotalBytesWritten + *bytesWritten + META_SIZE + DATA_BLOCK_TYPE_FIELD_SIZE;
+					dataBlockPadding = (DATA_BLOCK_ALIGNMENT - (dataOffset % DATA_BLOCK_ALIGNMENT)) % DATA_BLOCK_ALIGNMENT;
+					metaTypeSize = dataBlockPadding;
+
+					// Final location of the data isn't known when encoding in parallel, so padding is adjusted later
+					if(mDeferReferences)
+						mAlignedDataBlocks.push_back(AlignedDataBlock(mTotalBytesWritten + *bytesWritten, dataBlockPadding));
+				}
+
 				// Copy field ID & other meta-data like field size and type
-				int metaData = encodeFieldMetaData(curGenericField->mUniqueId, curGenericField->getTypeSize(), 
+				int metaData = encodeFieldMetaData(curGenericField->mUniqueId, metaTypeSize, 
 					curGenericField->mIsVectorType, curGenericField->mType, curGenericField->hasDynamicSize());
 				COPY_TO_BUFFER(&metaData, META_SIZE)
 
@@ -215,7 +379,7 @@ namespace BansheeEngine
 							{
 								std::shared_ptr<IReflectable> childObject = curField->getArrayValue(object, arrIdx); 
 
-								UINT32 objId = registerObjectPtr(childObject);
+								UINT32 objId = registerObjectPtr(childObject, mTotalBytesWritten + *bytesWritten);
 								COPY_TO_BUFFER(&objId, sizeof(UINT32))
 							}
 
@@ -232,7 +396,7 @@ namespace BansheeEngine
 								buffer = complexTypeToBuffer(&childObject, buffer, bufferLength, bytesWritten, flushBufferCallback);
 								if(buffer == nullptr)
 								{
-									si->onSerializationEnded(object);
+									si->onSerializationEnded(object, mContext);
 									return nullptr;
 								}
 							}
@@ -243,6 +407,38 @@ namespace BansheeEngine
 						{
 							RTTIPlainFieldBase* curField = static_cast<RTTIPlainFieldBase*>(curGenericField);
 
+							// Copy contiguous arrays in as few blocks as possible, splitting them only where the buffer is flushed
+							UINT8* arrayData = arrayNumElems > 0 ? curField->getArrayData(object) : nullptr;
+							if(arrayData != nullptr)
+							{
+								UINT32 bytesToCopy = arrayNumElems * curField->getTypeSize();
+								while(bytesToCopy > 0)
+								{
+									if((UINT32)*bytesWritten >= bufferLength)
+									{
+										mTotalBytesWritten += *bytesWritten;
+										buffer = flushBufferCallback(buffer - *bytesWritten, *bytesWritten, bufferLength);
+										if(buffer == nullptr || bufferLength == 0)
+										{
+											si->onSerializationEnded(object, mContext);
+											return nullptr;
+										}
+
+										*bytesWritten = 0;
+									}
+
+									UINT32 copySize = std::min(bytesToCopy, bufferLength - (UINT32)*bytesWritten);
+									memcpy(buffer, arrayData, copySize);
+
+									buffer += copySize;
+									arrayData += copySize;
+									*bytesWritten += copySize;
+									bytesToCopy -= copySize;
+								}
+
+								break;
+							}
+
 							for(UINT32 arrIdx = 0; arrIdx < arrayNumElems; arrIdx++)
 							{
 								UINT32 typeSize = 0;
@@ -255,18 +451,34 @@ namespace BansheeEngine
 								{
 									mTotalBytesWritten += *bytesWritten;
 									buffer = flushBufferCallback(buffer - *bytesWritten, *bytesWritten, bufferLength);
-									if(buffer == nullptr || bufferLength < typeSize)
+									if(buffer == nullptr)
 									{
+										si->onSerializationEnded(object, mContext);
 										return nullptr;
-										si->onSerializationEnded(object);
 									}
 
 									*bytesWritten = 0;
 								}
 
-								curField->arrayElemToBuffer(object, arrIdx, buffer);
-								buffer += typeSize;
-								*bytesWritten += typeSize;
+								if(typeSize <= bufferLength)
+								{
+									curField->arrayElemToBuffer(object, arrIdx, buffer);
+									buffer += typeSize;
+									*bytesWritten += typeSize;
+								}
+								else
+								{
+									// Element doesn't fit in the entire buffer, encode it separately and copy it in chunks
+									Vector<UINT8> elemData(typeSize);
+									curField->arrayElemToBuffer(object, arrIdx, &elemData[0]);
+
+									buffer = copyToBuffer(&elemData[0], typeSize, buffer, bufferLength, bytesWritten, flushBufferCallback);
+									if(buffer == nullptr)
+									{
+										si->onSerializationEnded(object, mContext);
+										return nullptr;
+									}
+								}
 							}
 
 							break;
@@ -286,7 +498,7 @@ namespace BansheeEngine
 							RTTIReflectablePtrFieldBase* curField = static_cast<RTTIReflectablePtrFieldBase*>(curGenericField);
 							std::shared_ptr<IReflectable> childObject = curField->getValue(object); 
 
-							UINT32 objId = registerObjectPtr(childObject);
+							UINT32 objId = registerObjectPtr(childObject, mTotalBytesWritten + *bytesWritten);
 							COPY_TO_BUFFER(&objId, sizeof(UINT32))
 
 							break;
@@ -299,7 +511,7 @@ namespace BansheeEngine
 							buffer = complexTypeToBuffer(&childObject, buffer, bufferLength, bytesWritten, flushBufferCallback);
 							if(buffer == nullptr)
 							{
-								si->onSerializationEnded(object);
+								si->onSerializationEnded(object, mContext);
 								return nullptr;
 							}
 
@@ -319,18 +531,34 @@ namespace BansheeEngine
 							{
 								mTotalBytesWritten += *bytesWritten;
 								buffer = flushBufferCallback(buffer - *bytesWritten, *bytesWritten, bufferLength);
-								if(buffer == nullptr || bufferLength < typeSize)
+								if(buffer == nullptr)
 								{
-									si->onSerializationEnded(object);
+									si->onSerializationEnded(object, mContext);
 									return nullptr;
 								}
 								*bytesWritten = 0;
 							}
 
+							if(typeSize <= bufferLength)
+							{
+								curField->toBuffer(object, buffer);
+								buffer += typeSize;
+								*bytesWritten += typeSize;
+							}
+							else
+							{
+								// Value doesn't fit in the entire buffer (e.g. a long string), encode it separately and 
+								// copy it in chunks
+								Vector<UINT8> fieldData(typeSize);
+								curField->toBuffer(object, &fieldData[0]);
 
-							curField->toBuffer(object, buffer);
-							buffer += typeSize;
-							*bytesWritten += typeSize;
+								buffer = copyToBuffer(&fieldData[0], typeSize, buffer, bufferLength, bytesWritten, flushBufferCallback);
+								if(buffer == nullptr)
+								{
+									si->onSerializationEnded(object, mContext);
+									return nullptr;
+								}
+							}
 
 							break;
 						}
@@ -341,7 +569,15 @@ namespace BansheeEngine
 
 							// Data block size
 							UINT32 dataBlockSize = value.getSize();
-							COPY_TO_BUFFER(&dataBlockSize, sizeof(UINT32))
+							COPY_TO_BUFFER(&dataBlockSize, DATA_BLOCK_TYPE_FIELD_SIZE)
+
+							// Data block padding
+							if(dataBlockPadding > 0)
+							{
+								UINT8 padding[DATA_BLOCK_ALIGNMENT];
+								memset(padding, 0, sizeof(padding));
+								COPY_TO_BUFFER(padding, dataBlockPadding)
+							}
 
 							// Data block data
 							UINT8* dataToStore = value.getData();
@@ -367,7 +603,7 @@ namespace BansheeEngine
 									buffer = flushBufferCallback(buffer - *bytesWritten, *bytesWritten, bufferLength);
 									if(buffer == nullptr || bufferLength == 0) 
 									{
-										si->onSerializationEnded(object);
+										si->onSerializationEnded(object, mContext);
 										return nullptr;
 									}
 									*bytesWritten = 0;
@@ -384,7 +620,7 @@ namespace BansheeEngine
 				}
 			}
 
-			si->onSerializationEnded(object);
+			si->onSerializationEnded(object, mContext);
 
 			si = si->getBaseClass();
 			isBaseClass = true;
@@ -394,7 +630,189 @@ namespace BansheeEngine
 		return buffer;
 	}
 
-	bool BinarySerializer::decodeInternal(std::shared_ptr<IReflectable> object, UINT8* data, UINT32 dataLength, UINT32& bytesRead)
+	UINT8* BinarySerializer::encodeParallel(IReflectable* object, UINT8* buffer, UINT32& bufferLength, 
+		int* bytesWritten, std::function<UINT8*(UINT8*, int, UINT32&)> flushBufferCallback)
+	{
+		// Objects are encoded in waves. All objects in a wave are encoded in parallel, each in its own buffer and with
+		// references to other objects left unassigned. Once the wave is done its objects are processed in order, assigning 
+		// ids to their references (registering newly found objects for the next wave) and writing them to the output. 
+		// This way ids are assigned, and objects are written, in exactly the same order as when encoding serially.
+		Vector<IReflectable*> waveObjects;
+		Vector<UINT32> waveObjectIds;
+
+		waveObjects.push_back(object);
+		waveObjectIds.push_back(findOrCreatePersistentId(object));
+
+		UINT32 numQueuedObjects = 0;
+		while(!waveObjects.empty())
+		{
+			UINT32 numObjects = (UINT32)waveObjects.size();
+			Vector<EncodedObject> encodedObjects(numObjects);
+
+			parallelFor(0, numObjects, [&](UINT32 idx)
+			{
+				encodeDeferred(waveObjects[idx], waveObjectIds[idx], mContext, encodedObjects[idx]);
+			}, 1);
+
+			for(UINT32 i = 0; i < numObjects; i++)
+			{
+				EncodedObject& encodedObject = encodedObjects[i];
+				if(encodedObject.error != nullptr)
+					std::rethrow_exception(encodedObject.error);
+
+				for(auto& reference : encodedObject.references)
+				{
+					UINT32 objId = registerObjectPtr(reference.object, reference.offset);
+					memcpy(&encodedObject.data[reference.offset], &objId, sizeof(UINT32));
+				}
+
+				buffer = writeEncodedObject(encodedObject, buffer, bufferLength, bytesWritten, flushBufferCallback);
+				if(buffer == nullptr)
+					return nullptr;
+			}
+
+			// Objects registered by this wave form the next one
+			waveObjects.clear();
+			waveObjectIds.clear();
+
+			for(; numQueuedObjects < (UINT32)mObjectsToEncode.size(); numQueuedObjects++)
+			{
+				waveObjects.push_back(mObjectsToEncode[numQueuedObjects].object.get());
+				waveObjectIds.push_back(mObjectsToEncode[numQueuedObjects].objectId);
+			}
+		}
+
+		return buffer;
+	}
+
+	void BinarySerializer::encodeDeferred(IReflectable* object, UINT32 objectId, SerializationContext* context, EncodedObject& output)
+	{
+		static const UINT32 MIN_BUFFER_SIZE = 4096;
+
+		try
+		{
+			BinarySerializer serializer;
+			serializer.mDeferReferences = true;
+			serializer.mContext = context;
+
+			// Data is encoded directly into the output, which grows whenever it gets full
+			UINT32 dataSize = 0;
+			output.data.resize(MIN_BUFFER_SIZE);
+
+			auto growBuffer = [&](UINT8* buffer, int bytesWritten, UINT32& newBufferSize)
+			{
+				dataSize += bytesWritten;
+
+				if(output.data.size() < (dataSize + MIN_BUFFER_SIZE))
+					output.data.resize(std::max(output.data.size() * 2, (size_t)(dataSize + MIN_BUFFER_SIZE)));
+
+				newBufferSize = (UINT32)output.data.size() - dataSize;
+				return &output.data[dataSize];
+			};
+
+			int bytesWritten = 0;
+			UINT32 bufferLength = (UINT32)output.data.size();
+			UINT8* buffer = serializer.encodeInternal(object, objectId, &output.data[0], bufferLength, &bytesWritten, growBuffer);
+			if(buffer == nullptr)
+			{
+				BS_EXCEPT(InternalErrorException, 
+					"Destination buffer is null or not large enough.");
+			}
+
+			output.data.resize(dataSize + bytesWritten);
+			output.references.swap(serializer.mDeferredReferences);
+			output.alignedDataBlocks.swap(serializer.mAlignedDataBlocks);
+		}
+		catch(...)
+		{
+			// Reported once the parallel encode completes, on the thread that started it
+			output.error = std::current_exception();
+		}
+	}
+
+	UINT8* BinarySerializer::writeEncodedObject(const EncodedObject& encodedObject, UINT8* buffer, UINT32& bufferLength, 
+		int* bytesWritten, std::function<UINT8*(UINT8*, int, UINT32&)> flushBufferCallback)
+	{
+		static const UINT32 META_SIZE = 4; // Meta field size
+		static const UINT32 DATA_BLOCK_TYPE_FIELD_SIZE = 4; // Size of the field storing the size of a data block
+
+		const UINT8* data = encodedObject.data.empty() ? nullptr : &encodedObject.data[0];
+		UINT32 readOffset = 0;
+
+		// Padding of aligned data blocks depends on their final location, so their meta data is encoded again
+		for(auto& dataBlock : encodedObject.alignedDataBlocks)
+		{
+			buffer = copyToBuffer(data + readOffset, dataBlock.metaOffset - readOffset, buffer, bufferLength, bytesWritten, flushBufferCallback);
+			if(buffer == nullptr)
+				return nullptr;
+
+			UINT32 dataOffset = mTotalBytesWritten + *bytesWritten + META_SIZE + DATA_BLOCK_TYPE_FIELD_SIZE;
+			UINT32 padding = (DATA_BLOCK_ALIGNMENT - (dataOffset % DATA_BLOCK_ALIGNMENT)) % DATA_BLOCK_ALIGNMENT;
+
+			UINT32 metaData = 0;
+			memcpy(&metaData, data + dataBlock.metaOffset, META_SIZE);
+
+			bool isArray;
+			SerializableFieldType fieldType;
+			UINT16 fieldId;
+			UINT8 fieldSize;
+			bool hasDynamicSize;
+			decodeFieldMetaData(metaData, fieldId, fieldSize, isArray, fieldType, hasDynamicSize);
+			metaData = encodeFieldMetaData(fieldId, padding, isArray, fieldType, hasDynamicSize);
+
+			UINT8 paddingData[DATA_BLOCK_ALIGNMENT];
+			memset(paddingData, 0, sizeof(paddingData));
+
+			buffer = copyToBuffer((UINT8*)&metaData, META_SIZE, buffer, bufferLength, bytesWritten, flushBufferCallback);
+			if(buffer != nullptr)
+			{
+				buffer = copyToBuffer(data + dataBlock.metaOffset + META_SIZE, DATA_BLOCK_TYPE_FIELD_SIZE, buffer, 
+					bufferLength, bytesWritten, flushBufferCallback);
+			}
+
+			if(buffer != nullptr)
+				buffer = copyToBuffer(paddingData, padding, buffer, bufferLength, bytesWritten, flushBufferCallback);
+
+			if(buffer == nullptr)
+				return nullptr;
+
+			readOffset = dataBlock.metaOffset + META_SIZE + DATA_BLOCK_TYPE_FIELD_SIZE + dataBlock.padding;
+		}
+
+		return copyToBuffer(data + readOffset, (UINT32)encodedObject.data.size() - readOffset, buffer, bufferLength, 
+			bytesWritten, flushBufferCallback);
+	}
+
+	UINT8* BinarySerializer::copyToBuffer(const UINT8* data, UINT32 size, UINT8* buffer, UINT32& bufferLength, 
+		int* bytesWritten, std::function<UINT8*(UINT8*, int, UINT32&)> flushBufferCallback)
+	{
+		while(size > 0)
+		{
+			UINT32 remainingSpaceInBuffer = bufferLength - *bytesWritten;
+			if(remainingSpaceInBuffer == 0)
+			{
+				mTotalBytesWritten += *bytesWritten;
+				buffer = flushBufferCallback(buffer - *bytesWritten, *bytesWritten, bufferLength);
+				if(buffer == nullptr || bufferLength == 0)
+					return nullptr;
+
+				*bytesWritten = 0;
+				continue;
+			}
+
+			UINT32 copySize = std::min(size, remainingSpaceInBuffer);
+			memcpy(buffer, data, copySize);
+
+			buffer += copySize;
+			*bytesWritten += copySize;
+			data += copySize;
+			size -= copySize;
+		}
+
+		return buffer;
+	}
+
+	bool BinarySerializer::decodeInternal(const std::shared_ptr<IReflectable>& object, DecodeSource& source, UINT64 dataLength, UINT64& bytesRead)
 	{
 		static const int META_SIZE = 4; // Meta field size
 		static const int NUM_ELEM_FIELD_SIZE = 4; // Size of the field storing number of array elements
@@ -421,8 +839,7 @@ namespace BansheeEngine
 		ObjectMetaData objectMetaData;
 		objectMetaData.objectMeta = 0;
 		objectMetaData.typeId = 0;
-		memcpy(&objectMetaData, data, sizeof(ObjectMetaData));
-		data += sizeof(ObjectMetaData);
+		source.read(bytesRead, &objectMetaData, sizeof(ObjectMetaData));
 		bytesRead += sizeof(ObjectMetaData);
 
 		UINT32 objectId = 0;
@@ -440,7 +857,7 @@ namespace BansheeEngine
 					"Error decoding data.");
 			}
 
-			memcpy((void*)&metaData, data, META_SIZE);
+			source.read(bytesRead, &metaData, META_SIZE);
 
 			if(isObjectMetaData(metaData)) // We've reached a new object
 			{
@@ -453,7 +870,7 @@ namespace BansheeEngine
 				ObjectMetaData objMetaData;
 				objMetaData.objectMeta = 0;
 				objMetaData.typeId = 0;
-				memcpy(&objMetaData, data, sizeof(ObjectMetaData));
+				source.read(bytesRead, &objMetaData, sizeof(ObjectMetaData));
 
 				UINT32 objId = 0;
 				UINT32 objTypeId = 0;
@@ -477,7 +894,6 @@ namespace BansheeEngine
 						si->onDeserializationStarted(object.get());
 					}
 
-					data += sizeof(ObjectMetaData);
 					bytesRead += sizeof(ObjectMetaData);
 					continue;
 				}
@@ -495,7 +911,6 @@ namespace BansheeEngine
 				}
 			}
 
-			data += META_SIZE;
 			bytesRead += META_SIZE;
 
 			bool isArray;
@@ -541,8 +956,7 @@ namespace BansheeEngine
 						"Error decoding data.");
 				}
 
-				memcpy((void*)&arrayNumElems, data, NUM_ELEM_FIELD_SIZE);
-				data += NUM_ELEM_FIELD_SIZE;
+				source.read(bytesRead, &arrayNumElems, NUM_ELEM_FIELD_SIZE);
 				bytesRead += NUM_ELEM_FIELD_SIZE;
 
 				if(curGenericField != nullptr)
@@ -563,8 +977,7 @@ namespace BansheeEngine
 							}
 
 							int objectId = 0;
-							memcpy(&objectId, data, COMPLEX_TYPE_FIELD_SIZE);
-							data += COMPLEX_TYPE_FIELD_SIZE;
+							source.read(bytesRead, &objectId, COMPLEX_TYPE_FIELD_SIZE);
 							bytesRead += COMPLEX_TYPE_FIELD_SIZE;
 
 							if(curField != nullptr)
@@ -585,8 +998,8 @@ namespace BansheeEngine
 									bool needsDecoding = (curField->getFlags() & RTTI_Flag_WeakRef) == 0 && !objToDecode.isDecoded;
 									if(needsDecoding)
 									{
-										UINT32 objectBytesRead = objToDecode.locationInFile;
-										decodeInternal(objToDecode.object, objToDecode.locationInBuffer, dataLength, objectBytesRead);
+										UINT64 objectBytesRead = objToDecode.locationInFile;
+										decodeInternal(objToDecode.object, source, source.getLength(), objectBytesRead);
 
 										objToDecode.isDecoded = true;
 									}
@@ -613,16 +1026,15 @@ namespace BansheeEngine
 							int complexTypeSize = 0;
 							if(curField != nullptr)
 							{
-								std::shared_ptr<IReflectable> complexType = complexTypeFromBuffer(curField, data, &complexTypeSize);
+								std::shared_ptr<IReflectable> complexType = complexTypeFromBuffer(curField, source, bytesRead, &complexTypeSize);
 								curField->setArrayValue(object.get(), i, *complexType);
 							}
 							else
 							{
-								memcpy(&complexTypeSize, data, COMPLEX_TYPE_FIELD_SIZE);
+								source.read(bytesRead, &complexTypeSize, COMPLEX_TYPE_FIELD_SIZE);
 								complexTypeSize += COMPLEX_TYPE_FIELD_SIZE;
 							}
 
-							data += complexTypeSize;
 							bytesRead += complexTypeSize;
 						}
 						break;
@@ -631,16 +1043,36 @@ namespace BansheeEngine
 					{
 						RTTIPlainFieldBase* curField = static_cast<RTTIPlainFieldBase*>(curGenericField);
 
+						// Elements with static size can be copied (or skipped) all at once
+						if(!hasDynamicSize && arrayNumElems > 0)
+						{
+							UINT8* arrayData = curField != nullptr ? curField->getArrayData(object.get()) : nullptr;
+							if(arrayData != nullptr || curField == nullptr)
+							{
+								UINT64 arraySize = (UINT64)arrayNumElems * fieldSize;
+								if((bytesRead + arraySize) > dataLength)
+								{
+									BS_EXCEPT(InternalErrorException, 
+										"Error decoding data.");
+								}
+
+								if(arrayData != nullptr)
+									source.read(bytesRead, arrayData, arraySize);
+
+								bytesRead += arraySize;
+								break;
+							}
+						}
+
 						for(int i = 0; i < arrayNumElems; i++)
 						{
 							UINT32 typeSize = fieldSize;
 							if(hasDynamicSize)
-								memcpy(&typeSize, data, sizeof(UINT32));
+								source.read(bytesRead, &typeSize, sizeof(UINT32));
 
 							if(curField != nullptr)
-								curField->arrayElemFromBuffer(object.get(), i, data);
+								curField->arrayElemFromBuffer(object.get(), i, source.request(bytesRead, typeSize));
 
-							data += typeSize;
 							bytesRead += typeSize;
 						}
 						break;
@@ -666,8 +1098,7 @@ namespace BansheeEngine
 						}
 
 						int objectId = 0;
-						memcpy(&objectId, data, COMPLEX_TYPE_FIELD_SIZE);
-						data += COMPLEX_TYPE_FIELD_SIZE;
+						source.read(bytesRead, &objectId, COMPLEX_TYPE_FIELD_SIZE);
 						bytesRead += COMPLEX_TYPE_FIELD_SIZE;
 
 						if(curField != nullptr)
@@ -688,8 +1119,8 @@ namespace BansheeEngine
 								bool needsDecoding = (curField->getFlags() & RTTI_Flag_WeakRef) == 0 && !objToDecode.isDecoded;
 								if(needsDecoding)
 								{
-									UINT32 objectBytesRead = objToDecode.locationInFile;
-									decodeInternal(objToDecode.object, objToDecode.locationInBuffer, dataLength, objectBytesRead);
+									UINT64 objectBytesRead = objToDecode.locationInFile;
+									decodeInternal(objToDecode.object, source, source.getLength(), objectBytesRead);
 
 									objToDecode.isDecoded = true;
 								}
@@ -713,16 +1144,15 @@ namespace BansheeEngine
 						int complexTypeSize = 0;
 						if(curField != nullptr)
 						{
-							std::shared_ptr<IReflectable> complexType = complexTypeFromBuffer(curField, data, &complexTypeSize);
+							std::shared_ptr<IReflectable> complexType = complexTypeFromBuffer(curField, source, bytesRead, &complexTypeSize);
 							curField->setValue(object.get(), *complexType);
 						}
 						else
 						{
-							memcpy(&complexTypeSize, data, COMPLEX_TYPE_FIELD_SIZE);
+							source.read(bytesRead, &complexTypeSize, COMPLEX_TYPE_FIELD_SIZE);
 							complexTypeSize += COMPLEX_TYPE_FIELD_SIZE;
 						}
 
-						data += complexTypeSize;
 						bytesRead += complexTypeSize;
 
 						break;
@@ -733,12 +1163,11 @@ namespace BansheeEngine
 
 						UINT32 typeSize = fieldSize;
 						if(hasDynamicSize)
-							memcpy(&typeSize, data, sizeof(UINT32));
+							source.read(bytesRead, &typeSize, sizeof(UINT32));
 
 						if(curField != nullptr)
-							curField->fromBuffer(object.get(), data);
+							curField->fromBuffer(object.get(), source.request(bytesRead, typeSize));
 
-						data += typeSize;
 						bytesRead += typeSize;
 						break;
 					}
@@ -754,10 +1183,12 @@ namespace BansheeEngine
 
 						// Data block size
 						UINT32 dataBlockSize = 0;
-						memcpy(&dataBlockSize, data, DATA_BLOCK_TYPE_FIELD_SIZE);
-						data += DATA_BLOCK_TYPE_FIELD_SIZE;
+						source.read(bytesRead, &dataBlockSize, DATA_BLOCK_TYPE_FIELD_SIZE);
 						bytesRead += DATA_BLOCK_TYPE_FIELD_SIZE;
 
+						// Padding used for aligning the data, stored in place of the type size
+						bytesRead += fieldSize;
+
 						if((bytesRead + dataBlockSize) > dataLength)
 						{
 							BS_EXCEPT(InternalErrorException, 
@@ -767,14 +1198,24 @@ namespace BansheeEngine
 						// Data block data
 						if(curField != nullptr)
 						{
-							UINT8* dataCopy = curField->allocate(object.get(), dataBlockSize); // TODO - Low priority. I need to read files better, so I
-							memcpy(dataCopy, data, dataBlockSize);		//    can just pass the buffer pointer directly without copying (possibly large amounts of data)
+							const std::shared_ptr<void>& dataOwner = source.getDataOwner();
+							if(dataOwner != nullptr && (curField->getFlags() & RTTI_Flag_DataBlockView) != 0)
+							{
+								// Reference the data in place, the block keeps the source memory alive
+								ManagedDataBlock value(source.request(bytesRead, dataBlockSize), dataBlockSize, dataOwner);
+								curField->setValue(object.get(), value);
+							}
+							else
+							{
+								// Read directly into the block storage, so large blocks never need an intermediate copy
+								UINT8* dataCopy = curField->allocate(object.get(), dataBlockSize);
+								source.read(bytesRead, dataCopy, dataBlockSize);
 
-							ManagedDataBlock value(dataCopy, dataBlockSize); // Not managed because I assume the owner class will decide whether to delete the data or keep it
-							curField->setValue(object.get(), value);
+								ManagedDataBlock value(dataCopy, dataBlockSize); // Not managed because I assume the owner class will decide whether to delete the data or keep it
+								curField->setValue(object.get(), value);
+							}
 						}
 
-						data += dataBlockSize;
 						bytesRead += dataBlockSize;
 
 						break;
@@ -866,6 +1307,12 @@ exit:
 						case SerializableFT_Plain:
 							{
 								RTTIPlainFieldBase* curField = static_cast<RTTIPlainFieldBase*>(curGenericField);
+								if(!curField->hasDynamicSize())
+								{
+									objectSize += arrayNumElems * curField->getTypeSize();
+									break;
+								}
+
 								for(UINT32 arrIdx = 0; arrIdx < arrayNumElems; arrIdx++)
 								{
 									UINT32 typeSize = 0;
@@ -1043,19 +1490,18 @@ exit:
 		return buffer;
 	}
 
-	std::shared_ptr<IReflectable> BinarySerializer::complexTypeFromBuffer(RTTIReflectableFieldBase* field, UINT8* data, int* complexTypeSize)
+	std::shared_ptr<IReflectable> BinarySerializer::complexTypeFromBuffer(RTTIReflectableFieldBase* field, DecodeSource& source, UINT64 offset, int* complexTypeSize)
 	{
 		static const int COMPLEX_TYPE_FIELD_SIZE = 4; // Size of the field storing the size of a child complex type
 
-		memcpy(complexTypeSize, data, COMPLEX_TYPE_FIELD_SIZE);
-		data += COMPLEX_TYPE_FIELD_SIZE;
+		source.read(offset, complexTypeSize, COMPLEX_TYPE_FIELD_SIZE);
+		offset += COMPLEX_TYPE_FIELD_SIZE;
 
 		std::shared_ptr<IReflectable> emptyObject = nullptr;
 		if(*complexTypeSize > 0)
 		{
 			emptyObject = field->newObject();
-			UINT32 dummy = 0;
-			decodeInternal(emptyObject, data, *complexTypeSize, dummy);
+			decodeInternal(emptyObject, source, offset + *complexTypeSize, offset);
 		}
 
 		*complexTypeSize += COMPLEX_TYPE_FIELD_SIZE;
@@ -1077,11 +1523,17 @@ exit:
 		return objId;
 	}
 
-	UINT32 BinarySerializer::registerObjectPtr(std::shared_ptr<IReflectable> object)
+	UINT32 BinarySerializer::registerObjectPtr(std::shared_ptr<IReflectable> object, UINT32 offset)
 	{
 		if(object == nullptr)
 			return 0;
 
+		if(mDeferReferences)
+		{
+			mDeferredReferences.push_back(DeferredReference(offset, object));
+			return 0;
+		}
+
 		void* ptrAddress = (void*)object.get();
 
 		auto iterFind = mObjectAddrToId.find(ptrAddress);
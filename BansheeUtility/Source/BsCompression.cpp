@@ -0,0 +1,258 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsCompression.h"
+
+namespace BansheeEngine
+{
+	static const UINT32 MIN_MATCH = 4; // Shortest back-reference that is encoded
+	static const UINT32 MAX_OFFSET = 65535; // Largest distance of a back-reference
+	static const UINT32 LAST_LITERALS = 5; // Number of bytes at the end of a block always encoded as literals
+	static const UINT32 MATCH_FIND_LIMIT = 12; // Matches can't start within this many bytes of the end of a block
+	static const UINT32 HASH_BITS = 12;
+	static const UINT32 RUN_MASK = 15;
+
+	/**
+	 * @brief	Reads four bytes at the specified location.
+	 */
+	static UINT32 read32(const UINT8* data)
+	{
+		UINT32 value;
+		memcpy(&value, data, sizeof(value));
+
+		return value;
+	}
+
+	/**
+	 * @brief	Calculates a hash of four bytes at the specified location.
+	 */
+	static UINT32 hashSequence(const UINT8* data)
+	{
+		return (read32(data) * 2654435761U) >> (32 - HASH_BITS);
+	}
+
+	/**
+	 * @brief	Writes an encoded length that didn't fit in the token. Returns the new output position, 
+	 * 			or null if there is not enough space in the output.
+	 */
+	static UINT8* writeLength(UINT8* output, const UINT8* outputEnd, UINT32 length)
+	{
+		while(length >= 255)
+		{
+			if(output >= outputEnd)
+				return nullptr;
+
+			*output++ = 255;
+			length -= 255;
+		}
+
+		if(output >= outputEnd)
+			return nullptr;
+
+		*output++ = (UINT8)length;
+		return output;
+	}
+
+	/**
+	 * @brief	Writes a sequence of literals optionally followed by a back-reference. Returns the new
+	 * 			output position, or null if there is not enough space in the output.
+	 */
+	static UINT8* writeSequence(UINT8* output, const UINT8* outputEnd, const UINT8* literals, UINT32 numLiterals, 
+		UINT32 offset, UINT32 matchLength)
+	{
+		if(output >= outputEnd)
+			return nullptr;
+
+		UINT8* token = output++;
+		*token = 0;
+
+		if(numLiterals >= RUN_MASK)
+		{
+			*token = (UINT8)(RUN_MASK << 4);
+			output = writeLength(output, outputEnd, numLiterals - RUN_MASK);
+
+			if(output == nullptr)
+				return nullptr;
+		}
+		else
+			*token = (UINT8)(numLiterals << 4);
+
+		if((UINT32)(outputEnd - output) < numLiterals)
+			return nullptr;
+
+		memcpy(output, literals, numLiterals);
+		output += numLiterals;
+
+		// Last sequence has no back-reference
+		if(matchLength == 0)
+			return output;
+
+		if((outputEnd - output) < 2)
+			return nullptr;
+
+		*output++ = (UINT8)(offset & 0xFF);
+		*output++ = (UINT8)(offset >> 8);
+
+		UINT32 encodedLength = matchLength - MIN_MATCH;
+		if(encodedLength >= RUN_MASK)
+		{
+			*token |= RUN_MASK;
+			output = writeLength(output, outputEnd, encodedLength - RUN_MASK);
+		}
+		else
+			*token |= (UINT8)encodedLength;
+
+		return output;
+	}
+
+	/**
+	 * @brief	Reads an encoded length that didn't fit in the token. Returns false if the input ends
+	 * 			before the length does.
+	 */
+	static bool readLength(const UINT8*& input, const UINT8* inputEnd, UINT32& length)
+	{
+		UINT8 value;
+		do
+		{
+			if(input >= inputEnd)
+				return false;
+
+			value = *input++;
+			length += value;
+		} while(value == 255);
+
+		return true;
+	}
+
+	UINT32 Compression::getMaxCompressedSize(UINT32 size)
+	{
+		return size + size / 255 + 16;
+	}
+
+	UINT32 Compression::compress(const UINT8* input, UINT32 inputSize, UINT8* output, UINT32 outputCapacity)
+	{
+		UINT8* outputIter = output;
+		const UINT8* outputEnd = output + outputCapacity;
+
+		UINT32 anchor = 0; // Start of the literals not yet written
+		if(inputSize > MATCH_FIND_LIMIT)
+		{
+			// Positions of recently seen sequences, offset by one so zero represents an empty entry
+			UINT32 hashTable[1 << HASH_BITS];
+			memset(hashTable, 0, sizeof(hashTable));
+
+			UINT32 matchLimit = inputSize - LAST_LITERALS;
+			UINT32 findLimit = inputSize - MATCH_FIND_LIMIT;
+
+			UINT32 pos = 0;
+			while(pos < findLimit)
+			{
+				UINT32 hash = hashSequence(input + pos);
+				UINT32 candidate = hashTable[hash];
+				hashTable[hash] = pos + 1;
+
+				if(candidate == 0 || (pos - (candidate - 1)) > MAX_OFFSET || read32(input + candidate - 1) != read32(input + pos))
+				{
+					// Skip faster through data that doesn't compress
+					pos += 1 + ((pos - anchor) >> 6);
+					continue;
+				}
+
+				UINT32 matchPos = candidate - 1;
+
+				// Extend the match backwards into the pending literals
+				while(pos > anchor && matchPos > 0 && input[pos - 1] == input[matchPos - 1])
+				{
+					pos--;
+					matchPos--;
+				}
+
+				UINT32 matchLength = MIN_MATCH;
+				while((pos + matchLength) < matchLimit && input[matchPos + matchLength] == input[pos + matchLength])
+					matchLength++;
+
+				outputIter = writeSequence(outputIter, outputEnd, input + anchor, pos - anchor, pos - matchPos, matchLength);
+				if(outputIter == nullptr)
+					return 0;
+
+				pos += matchLength;
+				anchor = pos;
+
+				// Register a position within the match, to improve chances of finding the next one
+				if(pos < findLimit)
+					hashTable[hashSequence(input + pos - 2)] = pos - 1;
+			}
+		}
+
+		outputIter = writeSequence(outputIter, outputEnd, input + anchor, inputSize - anchor, 0, 0);
+		if(outputIter == nullptr)
+			return 0;
+
+		return (UINT32)(outputIter - output);
+	}
+
+	bool Compression::decompress(const UINT8* input, UINT32 inputSize, UINT8* output, UINT32 outputSize)
+	{
+		const UINT8* inputEnd = input + inputSize;
+		UINT8* outputIter = output;
+		UINT8* outputEnd = output + outputSize;
+
+		while(input < inputEnd)
+		{
+			UINT8 token = *input++;
+
+			UINT32 numLiterals = token >> 4;
+			if(numLiterals == RUN_MASK)
+			{
+				if(!readLength(input, inputEnd, numLiterals))
+					return false;
+			}
+
+			if((UINT32)(inputEnd - input) < numLiterals || (UINT32)(outputEnd - outputIter) < numLiterals)
+				return false;
+
+			memcpy(outputIter, input, numLiterals);
+			input += numLiterals;
+			outputIter += numLiterals;
+
+			// Last sequence has no back-reference
+			if(input == inputEnd)
+				break;
+
+			if((inputEnd - input) < 2)
+				return false;
+
+			UINT32 offset = input[0] | (input[1] << 8);
+			input += 2;
+
+			if(offset == 0 || offset > (UINT32)(outputIter - output))
+				return false;
+
+			UINT32 matchLength = token & RUN_MASK;
+			if(matchLength == RUN_MASK)
+			{
+				if(!readLength(input, inputEnd, matchLength))
+					return false;
+			}
+
+			matchLength += MIN_MATCH;
+			if((UINT32)(outputEnd - outputIter) < matchLength)
+				return false;
+
+			const UINT8* match = outputIter - offset;
+			if(offset >= matchLength)
+			{
+				memcpy(outputIter, match, matchLength);
+				outputIter += matchLength;
+			}
+			else
+			{
+				// Overlapping back-reference, repeats the last "offset" bytes
+				for(UINT32 i = 0; i < matchLength; i++)
+					*outputIter++ = *match++;
+			}
+		}
+
+		return outputIter == outputEnd;
+	}
+}
\ No newline at end of file
@@ -32,7 +32,7 @@ namespace BansheeEngine
 			result.write(tempBuffer, numReadBytes);
 		}
 
-		free(tempBuffer);
+		bs_free(tempBuffer);
 		return result.str();
 	}
 
@@ -52,7 +52,7 @@ namespace BansheeEngine
 			result.write(tempBuffer, numReadBytes);
 		}
 
-		free(tempBuffer);
+		bs_free(tempBuffer);
 		return result.str();
 	}
 
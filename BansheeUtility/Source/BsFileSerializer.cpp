@@ -7,30 +7,344 @@
 #include "BsIReflectable.h"
 #include "BsBinarySerializer.h"
 #include "BsPath.h"
-
-#include <numeric>
+#include "BsFileSystem.h"
+#include "BsDataStream.h"
+#include "BsMemoryMappedFile.h"
+#include "BsCompression.h"
+#include "BsParallel.h"
 
 using namespace std::placeholders;
 
 namespace BansheeEngine
 {
+	/**
+	 * @brief	Read-only stream providing the decompressed contents of a compressed file. Blocks are decompressed
+	 *			on demand, a batch of consecutive blocks at a time, so neither the compressed nor the decompressed 
+	 *			contents ever need to be fully loaded in memory. Compressed data is read either from a stream, 
+	 *			or directly from memory.
+	 */
+	class FileSerializer::DecompressedDataStream : public DataStream
+	{
+	public:
+		DecompressedDataStream(const DataStreamPtr& source, UINT64 dataLength)
+			:mSource(source), mSourceData(nullptr), mCompressedBuffer(nullptr)
+		{
+			initialize(dataLength);
+		}
+
+		DecompressedDataStream(const UINT8* data, UINT64 dataLength)
+			:mSourceData(data), mCompressedBuffer(nullptr)
+		{
+			initialize(dataLength);
+		}
+
+		~DecompressedDataStream()
+		{
+			close();
+		}
+
+		/**
+		 * @copydoc DataStream::read
+		 */
+		size_t read(void* buf, size_t count)
+		{
+			if(mPos >= mSize)
+				return 0;
+
+			count = std::min(count, mSize - mPos);
+
+			size_t numRead = 0;
+			while(numRead < count)
+			{
+				if(mPos < mBufferStart || mPos >= (mBufferStart + mBufferSize))
+					decompressBatch(findBlock(mPos));
+
+				size_t numCopied = std::min(count - numRead, (size_t)(mBufferStart + mBufferSize - mPos));
+				memcpy((UINT8*)buf + numRead, mBuffer + (mPos - mBufferStart), numCopied);
+
+				numRead += numCopied;
+				mPos += numCopied;
+			}
+
+			return numRead;
+		}
+
+		/**
+		 * @copydoc DataStream::skip
+		 */
+		void skip(size_t count)
+		{
+			mPos = std::min(mPos + count, mSize);
+		}
+
+		/**
+		 * @copydoc DataStream::seek
+		 */
+		void seek(size_t pos)
+		{
+			mPos = std::min(pos, mSize);
+		}
+
+		/**
+		 * @copydoc DataStream::tell
+		 */
+		size_t tell() const
+		{
+			return mPos;
+		}
+
+		/**
+		 * @copydoc DataStream::eof
+		 */
+		bool eof() const
+		{
+			return mPos >= mSize;
+		}
+
+		/**
+		 * @copydoc DataStream::close
+		 */
+		void close()
+		{
+			if(mBuffer != nullptr)
+			{
+				bs_free(mBuffer);
+				mBuffer = nullptr;
+			}
+
+			if(mCompressedBuffer != nullptr)
+			{
+				bs_free(mCompressedBuffer);
+				mCompressedBuffer = nullptr;
+			}
+
+			mSource = nullptr;
+		}
+
+	private:
+		/**
+		 * @brief	Reads the header and the block table, and allocates buffers for a single batch of blocks.
+		 */
+		void initialize(UINT64 dataLength)
+		{
+			mPos = 0;
+			mBuffer = nullptr;
+			mBufferStart = 0;
+			mBufferSize = 0;
+
+			CompressedHeader header;
+			if(dataLength < sizeof(header))
+				BS_EXCEPT(InternalErrorException, "Error decoding data. Invalid compressed file header.");
+
+			readSource(0, &header, sizeof(header));
+
+			if(header.version != COMPRESSED_VERSION)
+				BS_EXCEPT(InternalErrorException, "Error decoding data. Unsupported compressed file version: " + toString(header.version));
+
+			UINT64 blockTableSize = (UINT64)header.numBlocks * sizeof(CompressedBlock);
+			if(header.blockTableOffset < sizeof(header) || header.blockTableOffset > dataLength || 
+				blockTableSize > (dataLength - header.blockTableOffset))
+			{
+				BS_EXCEPT(InternalErrorException, "Error decoding data. Invalid compressed file block table.");
+			}
+
+			// Find where each block starts, both in the file and in the decompressed data
+			mBlocks.resize(header.numBlocks);
+			mCompressedOffsets.resize(header.numBlocks);
+			mUncompressedOffsets.resize(header.numBlocks);
+
+			if(header.numBlocks > 0)
+				readSource(header.blockTableOffset, &mBlocks[0], blockTableSize);
+
+			UINT64 compressedOffset = sizeof(header);
+			UINT64 uncompressedOffset = 0;
+			for(UINT32 i = 0; i < header.numBlocks; i++)
+			{
+				if(mBlocks[i].uncompressedSize > header.blockSize || mBlocks[i].compressedSize > mBlocks[i].uncompressedSize)
+					BS_EXCEPT(InternalErrorException, "Error decoding data. Invalid compressed file block.");
+
+				mCompressedOffsets[i] = compressedOffset;
+				mUncompressedOffsets[i] = uncompressedOffset;
+
+				compressedOffset += mBlocks[i].compressedSize;
+				uncompressedOffset += mBlocks[i].uncompressedSize;
+			}
+
+			if(compressedOffset > header.blockTableOffset || uncompressedOffset != header.uncompressedSize)
+				BS_EXCEPT(InternalErrorException, "Error decoding data. Compressed file block table doesn't match its contents.");
+
+			mSize = (size_t)header.uncompressedSize;
+
+			UINT64 batchSize = (UINT64)std::min(header.numBlocks, DECOMPRESSION_BATCH_SIZE) * header.blockSize;
+			if(batchSize > 0)
+			{
+				mBuffer = (UINT8*)bs_alloc((size_t)batchSize);
+
+				if(mSourceData == nullptr)
+					mCompressedBuffer = (UINT8*)bs_alloc((size_t)batchSize);
+			}
+		}
+
+		/**
+		 * @brief	Returns the index of the block containing the provided offset in the decompressed data.
+		 */
+		UINT32 findBlock(size_t pos) const
+		{
+			auto iterFind = std::upper_bound(mUncompressedOffsets.begin(), mUncompressedOffsets.end(), (UINT64)pos);
+			return (UINT32)(iterFind - mUncompressedOffsets.begin()) - 1;
+		}
+
+		/**
+		 * @brief	Decompresses a batch of blocks starting at the provided block, in parallel.
+		 */
+		void decompressBatch(UINT32 firstBlock)
+		{
+			UINT32 lastBlock = std::min(firstBlock + DECOMPRESSION_BATCH_SIZE, (UINT32)mBlocks.size()) - 1;
+
+			UINT64 compressedStart = mCompressedOffsets[firstBlock];
+			UINT64 compressedSize = mCompressedOffsets[lastBlock] + mBlocks[lastBlock].compressedSize - compressedStart;
+
+			const UINT8* compressedData = nullptr;
+			if(mSourceData != nullptr)
+				compressedData = mSourceData + compressedStart;
+			else
+			{
+				// Blocks are stored one after another, so the entire batch can be read at once
+				readSource(compressedStart, mCompressedBuffer, compressedSize);
+				compressedData = mCompressedBuffer;
+			}
+
+			UINT64 uncompressedStart = mUncompressedOffsets[firstBlock];
+
+			std::atomic<bool> isValid(true);
+			parallelFor(firstBlock, lastBlock + 1, [&](UINT32 idx)
+			{
+				const CompressedBlock& block = mBlocks[idx];
+				const UINT8* src = compressedData + (mCompressedOffsets[idx] - compressedStart);
+				UINT8* dst = mBuffer + (mUncompressedOffsets[idx] - uncompressedStart);
+
+				if(block.compressedSize == block.uncompressedSize)
+					memcpy(dst, src, block.uncompressedSize);
+				else if(!Compression::decompress(src, block.compressedSize, dst, block.uncompressedSize))
+					isValid = false;
+			}, 1);
+
+			if(!isValid)
+			{
+				mBufferSize = 0;
+				BS_EXCEPT(InternalErrorException, "Error decoding data. Compressed file contents are corrupt.");
+			}
+
+			mBufferStart = uncompressedStart;
+			mBufferSize = mUncompressedOffsets[lastBlock] + mBlocks[lastBlock].uncompressedSize - uncompressedStart;
+		}
+
+		/**
+		 * @brief	Reads compressed file data at the provided offset. Throws an exception if not enough data could be read.
+		 */
+		void readSource(UINT64 offset, void* dest, UINT64 size)
+		{
+			if(mSourceData != nullptr)
+			{
+				memcpy(dest, mSourceData + offset, (size_t)size);
+				return;
+			}
+
+			mSource->seek((size_t)offset);
+			if(mSource->read(dest, (size_t)size) != size)
+				BS_EXCEPT(InternalErrorException, "Error decoding data. Unexpected end of stream.");
+		}
+
+		DataStreamPtr mSource;
+		const UINT8* mSourceData;
+
+		Vector<CompressedBlock> mBlocks;
+		Vector<UINT64> mCompressedOffsets;
+		Vector<UINT64> mUncompressedOffsets;
+
+		UINT8* mCompressedBuffer;
+		UINT8* mBuffer;
+		UINT64 mBufferStart;
+		UINT64 mBufferSize;
+		size_t mPos;
+	};
+
 	FileSerializer::FileSerializer()
+		:mCompressionBuffer(nullptr), mUncompressedSize(0)
 	{
-		mWriteBuffer = (UINT8*)bs_alloc<ScratchAlloc>(WRITE_BUFFER_SIZE);
+		mWriteBuffer = (UINT8*)bs_alloc<GenAlloc>(WRITE_BUFFER_SIZE);
 	}
 
 	FileSerializer::~FileSerializer()
 	{
-		bs_free<ScratchAlloc>(mWriteBuffer);
+		bs_free<GenAlloc>(mWriteBuffer);
 	}
 
-	void FileSerializer::encode(IReflectable* object, const Path& fileLocation)
+	void FileSerializer::encode(IReflectable* object, const Path& fileLocation, bool compress, IReflectable* metaData, 
+		bool parallel, SerializationContext* context)
 	{
 		mOutputStream.open(fileLocation.toString().c_str(), std::ios::out | std::ios::binary);
 
 		BinarySerializer bs;
 		int totalBytesWritten = 0;
-		bs.encode(object, mWriteBuffer, WRITE_BUFFER_SIZE, &totalBytesWritten, std::bind(&FileSerializer::flushBuffer, this, _1, _2, _3));
+
+		if(compress)
+		{
+			// Header is written once all blocks are known
+			CompressedHeader header;
+			memset(&header, 0, sizeof(header));
+			mOutputStream.write((const char*)&header, sizeof(header));
+
+			mCompressedBlocks.clear();
+			mUncompressedSize = 0;
+
+			UINT8* blockBuffer = (UINT8*)bs_alloc<GenAlloc>(COMPRESSION_BLOCK_SIZE);
+			mCompressionBuffer = (UINT8*)bs_alloc<GenAlloc>(Compression::getMaxCompressedSize(COMPRESSION_BLOCK_SIZE));
+
+			bs.encode(object, blockBuffer, COMPRESSION_BLOCK_SIZE, &totalBytesWritten, 
+				std::bind(&FileSerializer::flushCompressedBuffer, this, _1, _2, _3), parallel, context);
+
+			bs_free<GenAlloc>(mCompressionBuffer);
+			bs_free<GenAlloc>(blockBuffer);
+			mCompressionBuffer = nullptr;
+
+			header.magic = COMPRESSED_MAGIC;
+			header.version = COMPRESSED_VERSION;
+			header.numBlocks = (UINT32)mCompressedBlocks.size();
+			header.blockSize = COMPRESSION_BLOCK_SIZE;
+			header.uncompressedSize = mUncompressedSize;
+			header.blockTableOffset = (UINT64)mOutputStream.tellp();
+
+			if(!mCompressedBlocks.empty())
+				mOutputStream.write((const char*)&mCompressedBlocks[0], mCompressedBlocks.size() * sizeof(CompressedBlock));
+
+			mOutputStream.seekp(0, std::ios::beg);
+			mOutputStream.write((const char*)&header, sizeof(header));
+
+			mCompressedBlocks.clear();
+		}
+		else
+		{
+			bs.encode(object, mWriteBuffer, WRITE_BUFFER_SIZE, &totalBytesWritten, 
+				std::bind(&FileSerializer::flushBuffer, this, _1, _2, _3), parallel, context);
+		}
+
+		if(metaData != nullptr)
+		{
+			mOutputStream.seekp(0, std::ios::end);
+
+			MetaDataFooter footer;
+			footer.offset = (UINT64)mOutputStream.tellp();
+			footer.magic = META_DATA_MAGIC;
+
+			BinarySerializer metaDataBs;
+			int metaDataBytesWritten = 0;
+			metaDataBs.encode(metaData, mWriteBuffer, WRITE_BUFFER_SIZE, &metaDataBytesWritten, 
+				std::bind(&FileSerializer::flushBuffer, this, _1, _2, _3));
+
+			footer.size = (UINT32)metaDataBytesWritten;
+			mOutputStream.write((const char*)&footer, sizeof(footer));
+		}
 
 		mOutputStream.close();
 		mOutputStream.clear();
@@ -38,29 +352,107 @@ namespace BansheeEngine
 
 	std::shared_ptr<IReflectable> FileSerializer::decode(const Path& fileLocation)
 	{
-		mInputStream.open(fileLocation.toString().c_str(), std::ios::in | std::ios::ate | std::ios::binary);
-		
-		std::streamoff fileSize = mInputStream.tellg();
-		if(fileSize > std::numeric_limits<UINT32>::max())
-		{
-			BS_EXCEPT(InternalErrorException, 
-				"File size is larger that UINT32 can hold. Ask a programmer to use a bigger data type.");
-		}
+		DataStreamPtr stream = FileSystem::openFile(fileLocation);
+		std::shared_ptr<IReflectable> object = decode(stream);
+
+		stream->close();
+
+		return object;
+	}
 
-		UINT8* readBuffer = (UINT8*)bs_alloc<ScratchAlloc>((UINT32)fileSize); // TODO - Low priority. Consider upgrading BinarySerializer so we don't have to read everything at once
+	std::shared_ptr<IReflectable> FileSerializer::decode(const DataStreamPtr& stream)
+	{
+		// Any temporaries used during decoding are released at once when this ends
+		ScratchScope scratchScope;
+
+		// Meta data, if any, follows the object data
+		UINT64 dataLength = stream->size();
+
+		MetaDataFooter footer;
+		if(readMetaDataFooter(stream, footer))
+			dataLength = footer.offset;
+
+		stream->seek(0);
+
+		CompressedHeader header;
+		memset(&header, 0, sizeof(header));
+		UINT32 headerSize = (UINT32)stream->read(&header, sizeof(header));
+
+		if(isCompressed((UINT8*)&header, headerSize))
+			return decodeCompressed(bs_shared_ptr<DecompressedDataStream>(stream, dataLength));
 
-		mInputStream.seekg(0, std::ios::beg);
-		mInputStream.read((char*)readBuffer, fileSize);
+		// Data is streamed from the file in chunks, so it never needs to be fully loaded in memory
+		stream->seek(0);
 
 		BinarySerializer bs;
-		std::shared_ptr<IReflectable> object = bs.decode(readBuffer, (UINT32)fileSize);
+		return bs.decode(stream, dataLength);
+	}
 
-		mInputStream.close();
-		mInputStream.clear();
+	std::shared_ptr<IReflectable> FileSerializer::decodeMapped(const Path& fileLocation)
+	{
+		MemoryMappedFilePtr file = bs_shared_ptr<MemoryMappedFile>(fileLocation);
 
-		bs_free<ScratchAlloc>(readBuffer);
+		return decode(file->getData(), file->getSize(), file);
+	}
 
-		return object;
+	std::shared_ptr<IReflectable> FileSerializer::decode(UINT8* data, UINT64 dataLength, const std::shared_ptr<void>& dataOwner)
+	{
+		// Any temporaries used during decoding are released at once when this ends
+		ScratchScope scratchScope;
+
+		UINT64 objectDataLength = dataLength;
+
+		MetaDataFooter footer;
+		if(readMetaDataFooter(data, dataLength, footer))
+			objectDataLength = footer.offset;
+
+		if(isCompressed(data, objectDataLength))
+			return decodeCompressed(bs_shared_ptr<DecompressedDataStream>(data, objectDataLength));
+
+		BinarySerializer bs;
+		return bs.decode(data, objectDataLength, dataOwner);
+	}
+
+	std::shared_ptr<IReflectable> FileSerializer::decodeMetaData(UINT8* data, UINT64 dataLength)
+	{
+		MetaDataFooter footer;
+		if(!readMetaDataFooter(data, dataLength, footer))
+			return nullptr;
+
+		BinarySerializer bs;
+		return bs.decode(data + footer.offset, footer.size);
+	}
+
+	std::shared_ptr<IReflectable> FileSerializer::decodeMetaData(const Path& fileLocation)
+	{
+		DataStreamPtr stream = FileSystem::openFile(fileLocation);
+		std::shared_ptr<IReflectable> metaData = decodeMetaData(stream);
+
+		stream->close();
+
+		return metaData;
+	}
+
+	std::shared_ptr<IReflectable> FileSerializer::decodeMetaData(const DataStreamPtr& stream)
+	{
+		MetaDataFooter footer;
+		if(!readMetaDataFooter(stream, footer))
+			return nullptr;
+
+		// Any temporaries used during decoding are released at once when this ends
+		ScratchScope scratchScope;
+
+		UINT8* data = (UINT8*)bs_alloc<ScratchAlloc>(footer.size);
+
+		stream->seek((size_t)footer.offset);
+		stream->read(data, footer.size);
+
+		BinarySerializer bs;
+		std::shared_ptr<IReflectable> metaData = bs.decode(data, footer.size);
+
+		bs_free<ScratchAlloc>(data);
+
+		return metaData;
 	}
 
 	UINT8* FileSerializer::flushBuffer(UINT8* bufferStart, int bytesWritten, UINT32& newBufferSize)
@@ -69,4 +461,93 @@ namespace BansheeEngine
 
 		return bufferStart;
 	}
+
+	UINT8* FileSerializer::flushCompressedBuffer(UINT8* bufferStart, int bytesWritten, UINT32& newBufferSize)
+	{
+		if(bytesWritten <= 0)
+			return bufferStart;
+
+		CompressedBlock block;
+		block.uncompressedSize = (UINT32)bytesWritten;
+		block.compressedSize = Compression::compress(bufferStart, block.uncompressedSize, mCompressionBuffer, 
+			Compression::getMaxCompressedSize(COMPRESSION_BLOCK_SIZE));
+
+		// Store blocks that don't compress as they are
+		if(block.compressedSize == 0 || block.compressedSize >= block.uncompressedSize)
+		{
+			block.compressedSize = block.uncompressedSize;
+			mOutputStream.write((const char*)bufferStart, block.uncompressedSize);
+		}
+		else
+			mOutputStream.write((const char*)mCompressionBuffer, block.compressedSize);
+
+		mCompressedBlocks.push_back(block);
+		mUncompressedSize += block.uncompressedSize;
+
+		return bufferStart;
+	}
+
+	bool FileSerializer::isCompressed(const UINT8* data, UINT64 dataLength)
+	{
+		if(dataLength < sizeof(UINT32))
+			return false;
+
+		UINT32 magic = 0;
+		memcpy(&magic, data, sizeof(magic));
+
+		return magic == COMPRESSED_MAGIC;
+	}
+
+	bool FileSerializer::readMetaDataFooter(const DataStreamPtr& stream, MetaDataFooter& footer)
+	{
+		size_t fileSize = stream->size();
+		if(fileSize < sizeof(footer))
+			return false;
+
+		stream->seek(fileSize - sizeof(footer));
+		if(stream->read(&footer, sizeof(footer)) != sizeof(footer))
+			return false;
+
+		return isValidMetaDataFooter(footer, fileSize);
+	}
+
+	bool FileSerializer::readMetaDataFooter(const UINT8* data, UINT64 dataLength, MetaDataFooter& footer)
+	{
+		if(dataLength < sizeof(footer))
+			return false;
+
+		memcpy(&footer, data + dataLength - sizeof(footer), sizeof(footer));
+		return isValidMetaDataFooter(footer, dataLength);
+	}
+
+	bool FileSerializer::findMetaData(const UINT8* data, UINT64 dataLength, UINT64& offset, UINT32& size)
+	{
+		MetaDataFooter footer;
+		if(!readMetaDataFooter(data, dataLength, footer))
+			return false;
+
+		offset = footer.offset;
+		size = footer.size;
+
+		return true;
+	}
+
+	bool FileSerializer::isValidMetaDataFooter(const MetaDataFooter& footer, UINT64 fileSize)
+	{
+		if(footer.magic != META_DATA_MAGIC)
+			return false;
+
+		return footer.offset <= fileSize && (fileSize - footer.offset) == ((UINT64)footer.size + sizeof(footer));
+	}
+
+	std::shared_ptr<IReflectable> FileSerializer::decodeCompressed(const std::shared_ptr<DecompressedDataStream>& stream)
+	{
+		// Decompressed data only lives until the next batch of blocks is decompressed, so data blocks can't 
+		// reference it in place
+		BinarySerializer bs;
+		std::shared_ptr<IReflectable> object = bs.decode(stream, stream->size());
+
+		stream->close();
+		return object;
+	}
 }
\ No newline at end of file
@@ -13,7 +13,7 @@ namespace BansheeEngine
 	FrameAlloc::MemBlock::~MemBlock()
 	{ }
 
-	UINT8* FrameAlloc::MemBlock::alloc(UINT8 amount)
+	UINT8* FrameAlloc::MemBlock::alloc(UINT32 amount)
 	{
 		UINT8* freePtr = &mData[mFreePtr];
 		mFreePtr += amount;
@@ -62,6 +62,42 @@ namespace BansheeEngine
 #endif
 	}
 
+	UINT8* FrameAlloc::alloc(UINT32 amount, UINT32 alignment)
+	{
+		assert((alignment & (alignment - 1)) == 0 && "Alignment must be a power of two.");
+
+#if BS_DEBUG_MODE
+		UINT32 headerSize = sizeof(UINT32);
+#else
+		UINT32 headerSize = 0;
+#endif
+
+		UINT8* freePtr = mFreeBlock->mData + mFreeBlock->mFreePtr + headerSize;
+		UINT32 padding = (UINT32)((alignment - ((size_t)freePtr & (alignment - 1))) & (alignment - 1));
+		UINT32 totalAmount = headerSize + padding + amount;
+
+		UINT32 freeMem = mFreeBlock->mSize - mFreeBlock->mFreePtr;
+		if(totalAmount > freeMem)
+		{
+			allocBlock(headerSize + alignment - 1 + amount);
+
+			freePtr = mFreeBlock->mData + headerSize;
+			padding = (UINT32)((alignment - ((size_t)freePtr & (alignment - 1))) & (alignment - 1));
+			totalAmount = headerSize + padding + amount;
+		}
+
+		UINT8* data = mFreeBlock->alloc(totalAmount) + padding + headerSize;
+
+#if BS_DEBUG_MODE
+		mTotalAllocBytes += totalAmount;
+
+		UINT32* storedSize = reinterpret_cast<UINT32*>(data - headerSize);
+		*storedSize = totalAmount;
+#endif
+
+		return data;
+	}
+
 	void FrameAlloc::dealloc(UINT8* data)
 	{
 		// Dealloc is only used for debug and can be removed if needed. All the actual deallocation
@@ -0,0 +1,88 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsFrameAllocRegistry.h"
+
+namespace BansheeEngine
+{
+	std::atomic<UINT32> FrameAllocRegistry::NextId(1);
+
+	BS_THREADLOCAL FrameAllocRegistry::ThreadEntry* FrameAllocRegistry::CachedEntry = nullptr;
+	BS_THREADLOCAL UINT32 FrameAllocRegistry::CachedRegistryId = 0;
+
+	FrameAllocRegistry::FrameAllocRegistry(UINT32 blockSize)
+		:mId(NextId++), mBlockSize(blockSize), mEntries(nullptr), mActiveFrame(0)
+	{ }
+
+	FrameAllocRegistry::~FrameAllocRegistry()
+	{
+		ThreadEntry* entry = mEntries.load();
+		while(entry != nullptr)
+		{
+			ThreadEntry* next = entry->next;
+
+			for(UINT32 i = 0; i < NUM_FRAMES; i++)
+				bs_delete(entry->allocs[i]);
+
+			bs_delete(entry);
+			entry = next;
+		}
+	}
+
+	FrameAlloc* FrameAllocRegistry::getFrameAlloc()
+	{
+		ThreadEntry* entry;
+		if(CachedRegistryId == mId)
+			entry = CachedEntry;
+		else
+		{
+			entry = findOrCreateEntry();
+
+			CachedEntry = entry;
+			CachedRegistryId = mId;
+		}
+
+		return entry->allocs[mActiveFrame.load(std::memory_order_acquire)];
+	}
+
+	void FrameAllocRegistry::advanceFrame()
+	{
+		UINT32 nextFrame = (mActiveFrame.load(std::memory_order_relaxed) + 1) % NUM_FRAMES;
+
+		ThreadEntry* entry = mEntries.load(std::memory_order_acquire);
+		while(entry != nullptr)
+		{
+			entry->allocs[nextFrame]->clear();
+			entry = entry->next;
+		}
+
+		mActiveFrame.store(nextFrame, std::memory_order_release);
+	}
+
+	FrameAllocRegistry::ThreadEntry* FrameAllocRegistry::findOrCreateEntry()
+	{
+		BS_THREAD_ID_TYPE threadId = BS_THREAD_CURRENT_ID;
+
+		// Entries are only ever added, so the list can be safely walked without locking
+		ThreadEntry* entry = mEntries.load(std::memory_order_acquire);
+		while(entry != nullptr)
+		{
+			if(entry->threadId == threadId)
+				return entry;
+
+			entry = entry->next;
+		}
+
+		ThreadEntry* newEntry = bs_new<ThreadEntry>();
+		newEntry->threadId = threadId;
+
+		for(UINT32 i = 0; i < NUM_FRAMES; i++)
+			newEntry->allocs[i] = bs_new<FrameAlloc>(mBlockSize);
+
+		newEntry->next = mEntries.load(std::memory_order_relaxed);
+		while(!mEntries.compare_exchange_weak(newEntry->next, newEntry, std::memory_order_release, std::memory_order_relaxed))
+		{ }
+
+		return newEntry;
+	}
+}
@@ -7,15 +7,74 @@
 
 namespace BansheeEngine
 {
+	/**
+	 * @brief	Set whenever a new type is registered, signaling that hierarchy indices need to be rebuilt.
+	 */
+	static std::atomic<bool> HierarchyDirty(true);
+
+	/**
+	 * @brief	Incremented every time hierarchy indices are rebuilt. Only accessed while holding the registry lock.
+	 */
+	static UINT64 HierarchyGeneration = 0;
+
+	/**
+	 * @brief	Guards the type registry, the derived class lists and rebuilding of hierarchy indices.
+	 */
+	struct RTTIRegistryLock
+	{
+		BS_MUTEX(mutex)
+	};
+
+	/**
+	 * @brief	Returns the registry lock. Constructed on first use since types register themselves
+	 * 			during static initialization.
+	 */
+	static RTTIRegistryLock& getRegistryLock()
+	{
+		static RTTIRegistryLock lock;
+		return lock;
+	}
+
+	static const UINT32 HIERARCHY_INDEX_BITS = 24;
+	static const UINT64 HIERARCHY_INDEX_MASK = (1ULL << HIERARCHY_INDEX_BITS) - 1;
+
+	/**
+	 * @brief	Packs a hierarchy index range along with the generation it was assigned in, so readers
+	 * 			can load it with a single atomic operation.
+	 */
+	static UINT64 packHierarchyRange(UINT64 generation, UINT32 start, UINT32 end)
+	{
+		return (generation << (HIERARCHY_INDEX_BITS * 2)) | ((UINT64)end << HIERARCHY_INDEX_BITS) | start;
+	}
+
 	void IReflectable::_registerDerivedClass(RTTITypeBase* derivedClass)
 	{
-		if(_isTypeIdDuplicate(derivedClass->getRTTIId()))
+		_registerRTTIType(derivedClass, nullptr);
+	}
+
+	void IReflectable::_registerRTTIType(RTTITypeBase* type, RTTITypeBase* baseType)
+	{
+		BS_LOCK_MUTEX(getRegistryLock().mutex);
+
+		UINT32 typeId = type->getRTTIId();
+		if(typeId != TID_Abstract)
 		{
-			BS_EXCEPT(InternalErrorException, "RTTI type \"" + derivedClass->getRTTIName() + 
-				"\" has a duplicate ID: " + toString(derivedClass->getRTTIId()));
+			UnorderedMap<UINT32, RTTITypeBase*>& types = getTypesById();
+			if(types.find(typeId) != types.end())
+			{
+				BS_EXCEPT(InternalErrorException, "RTTI type \"" + type->getRTTIName() + 
+					"\" has a duplicate ID: " + toString(typeId));
+			}
+
+			types[typeId] = type;
 		}
 
-		getDerivedClasses().push_back(derivedClass);
+		if(baseType != nullptr)
+			baseType->getDerivedClasses().push_back(type);
+		else
+			getDerivedClasses().push_back(type);
+
+		HierarchyDirty.store(true, std::memory_order_release);
 	}
 
 	std::shared_ptr<IReflectable> IReflectable::createInstanceFromTypeId(UINT32 rttiTypeId)
@@ -30,24 +89,13 @@ namespace BansheeEngine
 
 	RTTITypeBase* IReflectable::_getRTTIfromTypeId(UINT32 rttiTypeId)
 	{
-		Stack<RTTITypeBase*> todo;
-		Vector<RTTITypeBase*>& rootClasses = getDerivedClasses();
+		BS_LOCK_MUTEX(getRegistryLock().mutex);
 
-		for(auto iter = rootClasses.begin(); iter != rootClasses.end(); ++iter)
-			todo.push(*iter);
+		UnorderedMap<UINT32, RTTITypeBase*>& types = getTypesById();
 
-		while(!todo.empty())
-		{
-			RTTITypeBase* curType = todo.top();
-			todo.pop();
-
-			if(curType->getRTTIId() == rttiTypeId)
-				return curType;
-
-			Vector<RTTITypeBase*>& derivedClasses = curType->getDerivedClasses();
-			for(auto iter = derivedClasses.begin(); iter != derivedClasses.end(); ++iter)
-				todo.push(*iter);
-		}
+		auto iterFind = types.find(rttiTypeId);
+		if(iterFind != types.end())
+			return iterFind->second;
 
 		return nullptr;
 	}
@@ -64,25 +112,92 @@ namespace BansheeEngine
 	{
 		assert(base != nullptr);
 
-		Stack<RTTITypeBase*> todo;
-		todo.push(base);
+		updateHierarchyIndices();
+
+		RTTITypeBase* type = getRTTI();
+		UINT64 typeRange = type->mHierarchyRange.load(std::memory_order_acquire);
+		UINT64 baseRange = base->mHierarchyRange.load(std::memory_order_acquire);
 
-		while (!todo.empty())
+		// Ranges can only be compared if both were assigned by the same rebuild
+		UINT32 generationShift = HIERARCHY_INDEX_BITS * 2;
+		if(typeRange != 0 && baseRange != 0 && (typeRange >> generationShift) == (baseRange >> generationShift))
 		{
-			RTTITypeBase* currentType = todo.top();
-			todo.pop();
+			UINT32 typeStart = (UINT32)(typeRange & HIERARCHY_INDEX_MASK);
+			UINT32 baseStart = (UINT32)(baseRange & HIERARCHY_INDEX_MASK);
+			UINT32 baseEnd = (UINT32)((baseRange >> HIERARCHY_INDEX_BITS) & HIERARCHY_INDEX_MASK);
+
+			return typeStart >= baseStart && typeStart <= baseEnd;
+		}
 
-			if(currentType->getRTTIId() == getRTTI()->getRTTIId())
+		// Types that aren't connected to the hierarchy yet, or whose indices are being rebuilt on another thread
+		while(type != nullptr)
+		{
+			if(type == base)
 				return true;
 
-			Vector<RTTITypeBase*>& derivedClasses = currentType->getDerivedClasses();
-			for(auto iter = derivedClasses.begin(); iter != derivedClasses.end(); ++iter)
-				todo.push(*iter);
+			type = type->getBaseClass();
 		}
 
 		return false;
 	}
 
+	UnorderedMap<UINT32, RTTITypeBase*>& IReflectable::getTypesById()
+	{
+		static UnorderedMap<UINT32, RTTITypeBase*> mTypesById;
+		return mTypesById;
+	}
+
+	void IReflectable::updateHierarchyIndices()
+	{
+		if(!HierarchyDirty.load(std::memory_order_acquire))
+			return;
+
+		BS_LOCK_MUTEX(getRegistryLock().mutex);
+
+		if(!HierarchyDirty.load(std::memory_order_relaxed))
+			return;
+
+		// Clear the flag first, so types registered while we rebuild trigger another rebuild
+		HierarchyDirty.store(false, std::memory_order_relaxed);
+		UINT64 generation = ++HierarchyGeneration;
+
+		// Assign pre-order indices, so that all types deriving from a type end up in a continuous
+		// range right after it. Second pair element signals the type's children are done. Each type's
+		// range is published with a single store once both of its ends are known.
+		Stack<std::pair<RTTITypeBase*, bool>> todo;
+		Vector<RTTITypeBase*>& rootClasses = getDerivedClasses();
+
+		for(auto iter = rootClasses.begin(); iter != rootClasses.end(); ++iter)
+			todo.push(std::make_pair(*iter, false));
+
+		Stack<UINT32> startIndices;
+		UINT32 nextIdx = 1;
+		while(!todo.empty())
+		{
+			std::pair<RTTITypeBase*, bool> current = todo.top();
+			todo.pop();
+
+			RTTITypeBase* curType = current.first;
+			if(current.second)
+			{
+				UINT32 start = startIndices.top();
+				startIndices.pop();
+
+				curType->mHierarchyRange.store(packHierarchyRange(generation, start, nextIdx - 1), std::memory_order_release);
+				continue;
+			}
+
+			assert(nextIdx <= HIERARCHY_INDEX_MASK);
+
+			startIndices.push(nextIdx++);
+			todo.push(std::make_pair(curType, true));
+
+			Vector<RTTITypeBase*>& derivedClasses = curType->getDerivedClasses();
+			for(auto iter = derivedClasses.begin(); iter != derivedClasses.end(); ++iter)
+				todo.push(std::make_pair(*iter, false));
+		}
+	}
+
 	UINT32 IReflectable::getTypeId() const
 	{ 
 		return getRTTI()->getRTTIId(); 
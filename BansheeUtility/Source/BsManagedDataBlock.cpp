@@ -10,10 +10,14 @@ namespace BansheeEngine
 		:mData(data), mSize(size), mManaged(false), mIsDataOwner(true), mDeallocator(deallocator)
 	{ }
 
+	ManagedDataBlock::ManagedDataBlock(UINT8* data, UINT32 size, const std::shared_ptr<void>& dataOwner)
+		:mData(data), mSize(size), mManaged(false), mIsDataOwner(true), mDeallocator(nullptr), mDataOwner(dataOwner)
+	{ }
+
 	ManagedDataBlock::ManagedDataBlock(UINT32 size)
 		:mSize(size), mManaged(true), mIsDataOwner(true), mDeallocator(nullptr)
 	{
-		mData = (UINT8*)bs_alloc<ScratchAlloc>(size);
+		mData = (UINT8*)bs_alloc<GenAlloc>(size);
 	}
 
 	ManagedDataBlock::ManagedDataBlock(const ManagedDataBlock& source)
@@ -22,6 +26,7 @@ namespace BansheeEngine
 		mSize = source.mSize;
 		mManaged = source.mManaged;
 		mDeallocator = source.mDeallocator;
+		mDataOwner = source.mDataOwner;
 
 		mIsDataOwner = true;
 		source.mIsDataOwner = false;
@@ -34,7 +39,7 @@ namespace BansheeEngine
 			if(mDeallocator != nullptr)
 				mDeallocator(mData);
 			else
-				bs_free<ScratchAlloc>(mData);
+				bs_free<GenAlloc>(mData);
 		}
 	}
 }
\ No newline at end of file
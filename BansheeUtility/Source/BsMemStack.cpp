@@ -32,6 +32,13 @@ namespace BansheeEngine
 		return ThreadMemStack->alloc(numBytes);
 	}
 
+	UINT8* MemStack::alloc(UINT32 numBytes, UINT32 alignment)
+	{
+		assert(ThreadMemStack != nullptr && "Stack allocation failed. Did you call beginThread?");
+
+		return ThreadMemStack->alloc(numBytes, alignment);
+	}
+
 	void MemStack::deallocLast(UINT8* data)
 	{
 		assert(ThreadMemStack != nullptr && "Stack deallocation failed. Did you call beginThread?");
@@ -12,47 +12,53 @@ using namespace std::placeholders;
 namespace BansheeEngine
 {
 	MemorySerializer::MemorySerializer()
+		:mBuffer(nullptr), mBufferSize(0), mBufferUsed(0)
 	{ }
 
 	MemorySerializer::~MemorySerializer()
-	{ }
-
-	UINT8* MemorySerializer::encode(IReflectable* object, UINT32& bytesWritten, std::function<void*(UINT32)> allocator)
 	{
-		using namespace std::placeholders;
-
-		BinarySerializer bs;
-
-		BufferPiece piece;
-		piece.buffer = (UINT8*)stackAlloc(WRITE_BUFFER_SIZE);
-		piece.size = 0;
-
-		mBufferPieces.push_back(piece);
+		if(mBuffer != nullptr)
+			bs_free(mBuffer);
+	}
 
-		bs.encode(object, piece.buffer, WRITE_BUFFER_SIZE, (INT32*)&bytesWritten, std::bind(&MemorySerializer::flushBuffer, this, _1, _2, _3));
+	UINT8* MemorySerializer::encode(IReflectable* object, UINT32& bytesWritten, std::function<void*(UINT32)> allocator, bool parallel)
+	{
+		encodeToBuffer(object, bytesWritten, parallel);
 
 		UINT8* resultBuffer;
 		if(allocator != nullptr)
+		{
 			resultBuffer = (UINT8*)allocator(bytesWritten);
+			memcpy(resultBuffer, mBuffer, bytesWritten);
+		}
 		else
-			resultBuffer = (UINT8*)bs_alloc(bytesWritten);
-
-		UINT32 offset = 0;
-		for(auto iter = mBufferPieces.begin(); iter != mBufferPieces.end(); ++iter)
 		{
-			if(iter->size > 0)
-			{
-				memcpy(resultBuffer + offset, iter->buffer, iter->size);
-				offset += iter->size;
-			}
+			// Hand the encode buffer over to the caller instead of copying it
+			resultBuffer = mBuffer;
+
+			mBuffer = nullptr;
+			mBufferSize = 0;
 		}
 
-		for(auto iter = mBufferPieces.rbegin(); iter != mBufferPieces.rend(); ++iter)
+		return resultBuffer;
+	}
+
+	UINT8* MemorySerializer::encodeToBuffer(IReflectable* object, UINT32& bytesWritten, bool parallel)
+	{
+		BinarySerializer bs;
+
+		if(mBuffer == nullptr)
 		{
-			stackDeallocLast(iter->buffer);
+			mBuffer = (UINT8*)bs_alloc(INITIAL_BUFFER_SIZE);
+			mBufferSize = INITIAL_BUFFER_SIZE;
 		}
 
-		return resultBuffer;
+		mBufferUsed = 0;
+		bs.encode(object, mBuffer, mBufferSize, (INT32*)&bytesWritten, 
+			std::bind(&MemorySerializer::flushBuffer, this, _1, _2, _3), parallel);
+
+		mBufferUsed = 0;
+		return mBuffer;
 	}
 
 	std::shared_ptr<IReflectable> MemorySerializer::decode(UINT8* buffer, UINT32 bufferSize)
@@ -65,14 +71,27 @@ namespace BansheeEngine
 
 	UINT8* MemorySerializer::flushBuffer(UINT8* bufferStart, int bytesWritten, UINT32& newBufferSize)
 	{
-		mBufferPieces.back().size = bytesWritten;
+		mBufferUsed += bytesWritten;
+
+		// Final flush, all the data is already in the buffer
+		if(newBufferSize == 0)
+			return mBuffer + mBufferUsed;
 
-		BufferPiece piece;
-		piece.buffer = (UINT8*)stackAlloc(WRITE_BUFFER_SIZE);
-		piece.size = 0;
+		// Serializer writes large data in chunks, so it only needs a small amount of guaranteed free space
+		UINT32 freeSpace = mBufferSize - mBufferUsed;
+		if(freeSpace < INITIAL_BUFFER_SIZE)
+		{
+			UINT32 newSize = std::max(mBufferSize * 2, mBufferUsed + INITIAL_BUFFER_SIZE);
+			UINT8* newBuffer = (UINT8*)bs_alloc(newSize);
+
+			memcpy(newBuffer, mBuffer, mBufferUsed);
+			bs_free(mBuffer);
 
-		mBufferPieces.push_back(piece);
+			mBuffer = newBuffer;
+			mBufferSize = newSize;
+		}
 
-		return piece.buffer;
+		newBufferSize = mBufferSize - mBufferUsed;
+		return mBuffer + mBufferUsed;
 	}
 }
\ No newline at end of file
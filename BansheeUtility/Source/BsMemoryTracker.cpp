@@ -0,0 +1,332 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsPrerequisitesUtil.h"
+#include "BsMemoryTracker.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Header placed in front of every tracked allocation.
+	 */
+	struct MemoryTrackerHeader
+	{
+		UINT64 size;
+		UINT32 tag;
+		UINT32 category;
+	};
+
+	static_assert(sizeof(MemoryTrackerHeader) <= MemoryTracker::HEADER_SIZE, "Tracker header doesn't fit in the reserved space.");
+
+	/**
+	 * @brief	Combined counters for a single allocator category. Only written to by MemoryTracker::endFrame.
+	 */
+	struct MemoryCategoryCounters
+	{
+		std::atomic<UINT64> currentBytes;
+		std::atomic<UINT64> peakBytes;
+		std::atomic<UINT64> numAllocs;
+		std::atomic<UINT64> numFrees;
+
+		std::atomic<UINT64> frameAllocBytes;
+		std::atomic<UINT64> frameFreeBytes;
+		std::atomic<UINT64> frameNumAllocs;
+		std::atomic<UINT64> frameNumFrees;
+	};
+
+	/**
+	 * @brief	Combined counters for a single allocation tag. Only written to by MemoryTracker::endFrame.
+	 */
+	struct MemoryTagCounters
+	{
+		std::atomic<const char*> name;
+		std::atomic<UINT64> currentBytes;
+		std::atomic<UINT64> peakBytes;
+		std::atomic<UINT64> numAllocs;
+	};
+
+	/**
+	 * @brief	Allocation counters of a single thread. Counters only ever grow and only the owning thread writes
+	 * 			to them, so the owning thread never needs to perform atomic read-modify-write operations, and
+	 * 			MemoryTracker::endFrame can fold them into the combined counters by looking at how much they
+	 * 			changed since the last fold.
+	 */
+	struct MemoryThreadCounters
+	{
+		enum { AllocBytes, FreeBytes, NumAllocs, NumFrees, NumCounters };
+
+		std::atomic<UINT64> categories[(UINT32)MemoryCategory::Count][NumCounters];
+		std::atomic<UINT64> tags[MemoryTracker::MAX_TAGS][NumCounters];
+
+		// Values of the counters at the time of the last fold. Only accessed by MemoryTracker::endFrame.
+		UINT64 foldedCategories[(UINT32)MemoryCategory::Count][NumCounters];
+		UINT64 foldedTags[MemoryTracker::MAX_TAGS][NumCounters];
+
+		std::atomic<bool> inUse;
+		MemoryThreadCounters* next;
+	};
+
+	// Note: Plain static arrays of atomics so they are zero initialized before any allocation can happen,
+	// regardless of static initialization order. Tracker must never allocate memory through a tracked allocator.
+	static MemoryCategoryCounters CategoryCounters[(UINT32)MemoryCategory::Count];
+	static MemoryTagCounters TagCounters[MemoryTracker::MAX_TAGS];
+	static std::atomic<UINT32> NumTags;
+	static std::atomic<MemoryThreadCounters*> ThreadCountersList;
+	static BS_THREADLOCAL MemoryThreadCounters* ActiveThreadCounters = nullptr;
+	BS_STATIC_MUTEX(TagMutex);
+
+	BS_THREADLOCAL UINT32 MemoryTracker::ActiveTag = 0;
+
+	/**
+	 * @brief	Returns counters of the calling thread, creating them if needed. Counters released by
+	 * 			threads that have ended are reused.
+	 */
+	static MemoryThreadCounters* getThreadCounters()
+	{
+		MemoryThreadCounters* counters = ActiveThreadCounters;
+		if(counters != nullptr)
+			return counters;
+
+		for(counters = ThreadCountersList.load(std::memory_order_acquire); counters != nullptr; counters = counters->next)
+		{
+			bool expected = false;
+			if(counters->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire))
+				break;
+		}
+
+		if(counters == nullptr)
+		{
+			counters = new (::malloc(sizeof(MemoryThreadCounters))) MemoryThreadCounters();
+			counters->inUse.store(true, std::memory_order_relaxed);
+
+			MemoryThreadCounters* head = ThreadCountersList.load(std::memory_order_relaxed);
+			do
+			{
+				counters->next = head;
+			} while(!ThreadCountersList.compare_exchange_weak(head, counters, std::memory_order_release, std::memory_order_relaxed));
+		}
+
+		ActiveThreadCounters = counters;
+		return counters;
+	}
+
+	/**
+	 * @brief	Increments a counter owned by the calling thread.
+	 */
+	static void increment(std::atomic<UINT64>& counter, UINT64 amount)
+	{
+		counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief	Adds the change of a thread counter since the last fold to the provided total.
+	 */
+	static void fold(const std::atomic<UINT64>& counter, UINT64& folded, UINT64& total)
+	{
+		UINT64 value = counter.load(std::memory_order_relaxed);
+		total += value - folded;
+		folded = value;
+	}
+
+	void* MemoryTracker::trackAlloc(void* data, size_t bytes, MemoryCategory category)
+	{
+		if(data == nullptr)
+			return nullptr;
+
+		MemoryTrackerHeader* header = (MemoryTrackerHeader*)data;
+		header->size = (UINT64)bytes;
+		header->tag = trackAlloc(bytes, category);
+		header->category = (UINT32)category;
+
+		return (UINT8*)data + HEADER_SIZE;
+	}
+
+	UINT32 MemoryTracker::trackAlloc(size_t bytes, MemoryCategory category)
+	{
+		UINT32 tag = ActiveTag;
+
+		MemoryThreadCounters* counters = getThreadCounters();
+
+		std::atomic<UINT64>* categoryCounters = counters->categories[(UINT32)category];
+		increment(categoryCounters[MemoryThreadCounters::AllocBytes], bytes);
+		increment(categoryCounters[MemoryThreadCounters::NumAllocs], 1);
+
+		std::atomic<UINT64>* tagCounters = counters->tags[tag];
+		increment(tagCounters[MemoryThreadCounters::AllocBytes], bytes);
+		increment(tagCounters[MemoryThreadCounters::NumAllocs], 1);
+
+		return tag;
+	}
+
+	void* MemoryTracker::trackFree(void* ptr, MemoryCategory category)
+	{
+		if(ptr == nullptr)
+			return nullptr;
+
+		MemoryTrackerHeader* header = (MemoryTrackerHeader*)((UINT8*)ptr - HEADER_SIZE);
+		assert(header->category == (UINT32)category && "Memory freed with a different allocator than it was allocated with.");
+
+		trackFree((size_t)header->size, header->tag, (MemoryCategory)header->category);
+
+		return header;
+	}
+
+	void MemoryTracker::trackFree(size_t bytes, UINT32 tag, MemoryCategory category)
+	{
+		MemoryThreadCounters* counters = getThreadCounters();
+
+		std::atomic<UINT64>* categoryCounters = counters->categories[(UINT32)category];
+		increment(categoryCounters[MemoryThreadCounters::FreeBytes], bytes);
+		increment(categoryCounters[MemoryThreadCounters::NumFrees], 1);
+
+		std::atomic<UINT64>* tagCounters = counters->tags[tag];
+		increment(tagCounters[MemoryThreadCounters::FreeBytes], bytes);
+		increment(tagCounters[MemoryThreadCounters::NumFrees], 1);
+	}
+
+	void MemoryTracker::endThread()
+	{
+		MemoryThreadCounters* counters = ActiveThreadCounters;
+		if(counters == nullptr)
+			return;
+
+		// Counters keep their values, so whatever the thread did since the last fold still gets reported
+		ActiveThreadCounters = nullptr;
+		counters->inUse.store(false, std::memory_order_release);
+	}
+
+	UINT32 MemoryTracker::registerTag(const char* name)
+	{
+		BS_LOCK_MUTEX(TagMutex);
+
+		UINT32 numTags = NumTags.load(std::memory_order_relaxed);
+		if(numTags == 0)
+		{
+			TagCounters[0].name.store("Untagged", std::memory_order_relaxed);
+			numTags = 1;
+		}
+
+		for(UINT32 i = 0; i < numTags; i++)
+		{
+			if(strcmp(TagCounters[i].name.load(std::memory_order_relaxed), name) == 0)
+				return i;
+		}
+
+		if(numTags == MAX_TAGS)
+			return 0;
+
+		TagCounters[numTags].name.store(name, std::memory_order_relaxed);
+		NumTags.store(numTags + 1, std::memory_order_release);
+
+		return numTags;
+	}
+
+	UINT32 MemoryTracker::getNumTags()
+	{
+		return std::max(1U, NumTags.load(std::memory_order_acquire));
+	}
+
+	MemoryCategoryStats MemoryTracker::getCategoryStats(MemoryCategory category)
+	{
+		MemoryCategoryCounters& counters = CategoryCounters[(UINT32)category];
+
+		MemoryCategoryStats stats;
+		stats.currentBytes = counters.currentBytes.load(std::memory_order_relaxed);
+		stats.peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+		stats.numAllocs = counters.numAllocs.load(std::memory_order_relaxed);
+		stats.numFrees = counters.numFrees.load(std::memory_order_relaxed);
+		stats.frameAllocBytes = counters.frameAllocBytes.load(std::memory_order_relaxed);
+		stats.frameFreeBytes = counters.frameFreeBytes.load(std::memory_order_relaxed);
+		stats.frameNumAllocs = counters.frameNumAllocs.load(std::memory_order_relaxed);
+		stats.frameNumFrees = counters.frameNumFrees.load(std::memory_order_relaxed);
+
+		return stats;
+	}
+
+	MemoryTagStats MemoryTracker::getTagStats(UINT32 tag)
+	{
+		assert(tag < getNumTags());
+
+		MemoryTagCounters& counters = TagCounters[tag];
+
+		MemoryTagStats stats;
+		stats.name = tag == 0 ? "Untagged" : counters.name.load(std::memory_order_relaxed);
+		stats.currentBytes = counters.currentBytes.load(std::memory_order_relaxed);
+		stats.peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+		stats.numAllocs = counters.numAllocs.load(std::memory_order_relaxed);
+
+		return stats;
+	}
+
+	void MemoryTracker::endFrame()
+	{
+		static const UINT32 NUM_CATEGORIES = (UINT32)MemoryCategory::Count;
+		static const UINT32 NUM_COUNTERS = MemoryThreadCounters::NumCounters;
+
+		UINT64 categoryChanges[NUM_CATEGORIES][NUM_COUNTERS];
+		UINT64 tagChanges[MAX_TAGS][NUM_COUNTERS];
+		memset(categoryChanges, 0, sizeof(categoryChanges));
+		memset(tagChanges, 0, sizeof(tagChanges));
+
+		// Gather everything all the threads did since the last frame
+		UINT32 numTags = getNumTags();
+		for(MemoryThreadCounters* counters = ThreadCountersList.load(std::memory_order_acquire); counters != nullptr; counters = counters->next)
+		{
+			for(UINT32 i = 0; i < NUM_CATEGORIES; i++)
+			{
+				for(UINT32 j = 0; j < NUM_COUNTERS; j++)
+					fold(counters->categories[i][j], counters->foldedCategories[i][j], categoryChanges[i][j]);
+			}
+
+			for(UINT32 i = 0; i < numTags; i++)
+			{
+				for(UINT32 j = 0; j < NUM_COUNTERS; j++)
+					fold(counters->tags[i][j], counters->foldedTags[i][j], tagChanges[i][j]);
+			}
+		}
+
+		// Memory might get freed on a different thread than it was allocated on, so only the combined values are meaningful
+		for(UINT32 i = 0; i < NUM_CATEGORIES; i++)
+		{
+			MemoryCategoryCounters& counters = CategoryCounters[i];
+			UINT64* changes = categoryChanges[i];
+
+			UINT64 current = counters.currentBytes.load(std::memory_order_relaxed) + 
+				changes[MemoryThreadCounters::AllocBytes] - changes[MemoryThreadCounters::FreeBytes];
+
+			counters.currentBytes.store(current, std::memory_order_relaxed);
+			counters.peakBytes.store(std::max(current, counters.peakBytes.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+			counters.numAllocs.fetch_add(changes[MemoryThreadCounters::NumAllocs], std::memory_order_relaxed);
+			counters.numFrees.fetch_add(changes[MemoryThreadCounters::NumFrees], std::memory_order_relaxed);
+
+			counters.frameAllocBytes.store(changes[MemoryThreadCounters::AllocBytes], std::memory_order_relaxed);
+			counters.frameFreeBytes.store(changes[MemoryThreadCounters::FreeBytes], std::memory_order_relaxed);
+			counters.frameNumAllocs.store(changes[MemoryThreadCounters::NumAllocs], std::memory_order_relaxed);
+			counters.frameNumFrees.store(changes[MemoryThreadCounters::NumFrees], std::memory_order_relaxed);
+		}
+
+		for(UINT32 i = 0; i < numTags; i++)
+		{
+			MemoryTagCounters& counters = TagCounters[i];
+			UINT64* changes = tagChanges[i];
+
+			UINT64 current = counters.currentBytes.load(std::memory_order_relaxed) + 
+				changes[MemoryThreadCounters::AllocBytes] - changes[MemoryThreadCounters::FreeBytes];
+
+			counters.currentBytes.store(current, std::memory_order_relaxed);
+			counters.peakBytes.store(std::max(current, counters.peakBytes.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+			counters.numAllocs.fetch_add(changes[MemoryThreadCounters::NumAllocs], std::memory_order_relaxed);
+		}
+	}
+
+	MemoryTagScope::MemoryTagScope(UINT32 tag)
+	{
+		mPrevTag = MemoryTracker::ActiveTag;
+		MemoryTracker::ActiveTag = tag;
+	}
+
+	MemoryTagScope::~MemoryTagScope()
+	{
+		MemoryTracker::ActiveTag = mPrevTag;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,127 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsParallel.h"
+#include "BsTaskScheduler.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Range state shared between all threads processing it.
+	 */
+	struct ParallelRangeState
+	{
+		std::atomic<UINT32> next;
+		UINT32 end;
+		UINT32 grainSize;
+		UINT32 numThreads;
+		const ParallelRange::ChunkWorker* worker;
+	};
+
+	/**
+	 * @brief	Keeps retrieving chunks from the range and processing them until the entire range is processed.
+	 */
+	static void processParallelRange(ParallelRangeState* state, UINT32 threadIdx)
+	{
+		while (true)
+		{
+			UINT32 chunkBegin = state->next.load();
+			UINT32 chunkSize = 0;
+
+			do
+			{
+				if (chunkBegin >= state->end)
+					return;
+
+				// Take a portion of the remaining work proportional to the number of threads, so that
+				// chunks get smaller as we near the end and threads can balance out
+				UINT32 remaining = state->end - chunkBegin;
+				chunkSize = std::max(state->grainSize, remaining / (state->numThreads * 2));
+				chunkSize = std::min(chunkSize, remaining);
+
+			} while (!state->next.compare_exchange_weak(chunkBegin, chunkBegin + chunkSize));
+
+			(*state->worker)(threadIdx, chunkBegin, chunkBegin + chunkSize);
+		}
+	}
+
+	UINT32 ParallelRange::getNumThreads(UINT32 begin, UINT32 end, UINT32 grainSize)
+	{
+		if (begin >= end || !TaskScheduler::isStarted())
+			return 1;
+
+		UINT32 count = end - begin;
+		UINT32 maxThreads = TaskScheduler::instance().getNumWorkers() + 1;
+
+		grainSize = getGrainSize(count, grainSize, maxThreads);
+		UINT32 numChunks = (count + grainSize - 1) / grainSize;
+
+		return std::max(1U, std::min(maxThreads, numChunks));
+	}
+
+	void ParallelRange::execute(UINT32 begin, UINT32 end, UINT32 grainSize, UINT32 numThreads, const ChunkWorker& worker)
+	{
+		if (begin >= end)
+			return;
+
+		if (numThreads <= 1)
+		{
+			worker(0, begin, end);
+			return;
+		}
+
+		ParallelRangeState state;
+		state.next = begin;
+		state.end = end;
+		state.grainSize = getGrainSize(end - begin, grainSize, numThreads);
+		state.numThreads = numThreads;
+		state.worker = &worker;
+
+		Vector<TaskPtr> helpers;
+		helpers.reserve(numThreads - 1);
+
+		// Helpers reference the range state on this stack frame, so they must all be done before we leave it,
+		// even if the worker throws
+		auto waitForHelpers = [&]()
+		{
+			for (auto& helper : helpers)
+			{
+				helper->cancel();
+				helper->wait();
+			}
+		};
+
+		try
+		{
+			for (UINT32 i = 1; i < numThreads; i++)
+			{
+				TaskPtr task = Task::create("ParallelRange", std::bind(&processParallelRange, &state, i), TaskPriority::High);
+				TaskScheduler::instance().addTask(task);
+
+				helpers.push_back(task);
+			}
+
+			processParallelRange(&state, 0);
+		}
+		catch (...)
+		{
+			// Stop distributing the rest of the range, helpers only need to finish their current chunk
+			state.next = end;
+
+			waitForHelpers();
+			throw;
+		}
+
+		// Range is fully distributed. Helpers that haven't started yet are no longer needed, and we 
+		// need to wait on the ones still processing their last chunk.
+		waitForHelpers();
+	}
+
+	UINT32 ParallelRange::getGrainSize(UINT32 count, UINT32 grainSize, UINT32 numThreads)
+	{
+		if (grainSize > 0)
+			return grainSize;
+
+		return std::max(1U, count / (numThreads * 16));
+	}
+}
\ No newline at end of file
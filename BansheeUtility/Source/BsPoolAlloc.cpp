@@ -0,0 +1,388 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsPrerequisitesUtil.h"
+#include "BsPoolAlloc.h"
+#include "BsSpinLock.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Size of the header placed in front of every allocation. Large enough to keep
+	 * 			the returned memory 16 byte aligned.
+	 */
+	static const UINT32 HEADER_SIZE = 16;
+
+	/**
+	 * @brief	Alignment of the chunks and large allocations requested from the OS.
+	 */
+	static const UINT32 ALIGNMENT = 16;
+
+	/**
+	 * @brief	Size class index stored in the header of allocations that are too large for the pool.
+	 */
+	static const UINT32 LARGE_ALLOCATION = 0xFFFFFFFF;
+
+	/**
+	 * @brief	Size of the chunks that blocks are carved out from.
+	 */
+	static const UINT32 CHUNK_SIZE = 64 * 1024;
+
+	static const UINT32 NUM_SIZE_CLASSES = 24;
+
+	/**
+	 * @brief	Largest allocation size, not counting the header, for each size class. Classes are
+	 * 			spaced 16 bytes apart up to 128 bytes, and four per power of two after that.
+	 */
+	static const UINT32 SIZE_CLASSES[NUM_SIZE_CLASSES] =
+	{
+		16, 32, 48, 64, 80, 96, 112, 128,
+		160, 192, 224, 256,
+		320, 384, 448, 512,
+		640, 768, 896, 1024,
+		1280, 1536, 1792, 2048
+	};
+
+	/**
+	 * @brief	Header placed in front of every allocation. Also holds the memory tracking data, 
+	 *			so tracked allocations don't need a separate header.
+	 */
+	struct BlockHeader
+	{
+		UINT32 sizeClass;
+		UINT32 tag;
+		UINT64 size;
+	};
+
+	static_assert(sizeof(BlockHeader) <= HEADER_SIZE, "Block header doesn't fit in the reserved space.");
+
+	/**
+	 * @brief	Overlaid on top of free blocks in order to link them in a free list.
+	 */
+	struct FreeBlock
+	{
+		FreeBlock* next;
+	};
+
+	/**
+	 * @brief	Free blocks of a single size class, shared between all threads.
+	 */
+	struct SharedPool
+	{
+		SpinLock lock;
+		FreeBlock* freeList;
+		std::atomic<UINT64> numChunks;
+		std::atomic<UINT64> numRetiredAllocs;
+		std::atomic<UINT64> numRetiredFrees;
+	};
+
+	/**
+	 * @brief	Free blocks and statistics of a single thread, for every size class.
+	 */
+	struct PoolAllocThreadCache
+	{
+		FreeBlock* freeLists[NUM_SIZE_CLASSES];
+		UINT32 numFree[NUM_SIZE_CLASSES];
+
+		// Only ever written by the owning thread, but read by getStats
+		std::atomic<UINT64> numAllocs[NUM_SIZE_CLASSES];
+		std::atomic<UINT64> numFrees[NUM_SIZE_CLASSES];
+	};
+
+	static SharedPool SharedPools[NUM_SIZE_CLASSES];
+
+	BS_STATIC_MUTEX(ThreadCachesMutex);
+	static Vector<PoolAllocThreadCache*>* ThreadCaches = nullptr;
+
+	BS_THREADLOCAL PoolAllocThreadCache* PoolAllocator::ActiveCache = nullptr;
+
+	/**
+	 * @brief	Allocates memory from the OS, aligned to ALIGNMENT.
+	 */
+	static void* allocAligned(size_t bytes)
+	{
+#if BS_PLATFORM == BS_PLATFORM_WIN32
+		return _aligned_malloc(bytes, ALIGNMENT);
+#else
+		void* data = nullptr;
+		if(posix_memalign(&data, ALIGNMENT, bytes) != 0)
+			return nullptr;
+
+		return data;
+#endif
+	}
+
+	/**
+	 * @brief	Frees memory allocated with allocAligned.
+	 */
+	static void freeAligned(void* data)
+	{
+#if BS_PLATFORM == BS_PLATFORM_WIN32
+		_aligned_free(data);
+#else
+		::free(data);
+#endif
+	}
+
+	/**
+	 * @brief	Returns the index of the smallest size class that can hold the specified number of bytes.
+	 * 			Caller must ensure the size isn't larger than the largest size class.
+	 */
+	static UINT32 getSizeClass(size_t bytes)
+	{
+		if(bytes <= 128)
+			return bytes > 0 ? (UINT32)((bytes - 1) / 16) : 0;
+
+		UINT32 idx = 8;
+		while(SIZE_CLASSES[idx] < bytes)
+			idx++;
+
+		return idx;
+	}
+
+	/**
+	 * @brief	Returns the size of a single block of the specified size class, including the header.
+	 */
+	static UINT32 getBlockSize(UINT32 sizeClass)
+	{
+		return SIZE_CLASSES[sizeClass] + HEADER_SIZE;
+	}
+
+	/**
+	 * @brief	Returns the maximum number of free blocks of the specified size class a thread cache
+	 * 			may hold before returning some of them to the shared pool.
+	 */
+	static UINT32 getMaxCachedBlocks(UINT32 sizeClass)
+	{
+		return (CHUNK_SIZE / getBlockSize(sizeClass)) * 2;
+	}
+
+	void* PoolAllocator::allocate(size_t bytes)
+	{
+		if(bytes > SIZE_CLASSES[NUM_SIZE_CLASSES - 1])
+		{
+			BlockHeader* header = (BlockHeader*)allocAligned(bytes + HEADER_SIZE);
+			header->sizeClass = LARGE_ALLOCATION;
+
+#if BS_MEMORY_TRACKING_ENABLED
+			header->size = (UINT64)bytes;
+			header->tag = MemoryTracker::trackAlloc(bytes, MemoryCategory::Pool);
+#endif
+
+			return (UINT8*)header + HEADER_SIZE;
+		}
+
+		UINT32 sizeClass = getSizeClass(bytes);
+		PoolAllocThreadCache* cache = getThreadCache();
+
+		if(cache->freeLists[sizeClass] == nullptr)
+			refill(cache, sizeClass);
+
+		FreeBlock* block = cache->freeLists[sizeClass];
+		cache->freeLists[sizeClass] = block->next;
+		cache->numFree[sizeClass]--;
+
+		cache->numAllocs[sizeClass].store(cache->numAllocs[sizeClass].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+		BlockHeader* header = (BlockHeader*)block;
+		header->sizeClass = sizeClass;
+
+#if BS_MEMORY_TRACKING_ENABLED
+		header->size = (UINT64)bytes;
+		header->tag = MemoryTracker::trackAlloc(bytes, MemoryCategory::Pool);
+#endif
+
+		return (UINT8*)header + HEADER_SIZE;
+	}
+
+	void PoolAllocator::free(void* ptr)
+	{
+		if(ptr == nullptr)
+			return;
+
+		BlockHeader* header = (BlockHeader*)((UINT8*)ptr - HEADER_SIZE);
+		UINT32 sizeClass = header->sizeClass;
+
+#if BS_MEMORY_TRACKING_ENABLED
+		MemoryTracker::trackFree((size_t)header->size, header->tag, MemoryCategory::Pool);
+#endif
+
+		if(sizeClass == LARGE_ALLOCATION)
+		{
+			freeAligned(header);
+			return;
+		}
+
+		PoolAllocThreadCache* cache = getThreadCache();
+
+		FreeBlock* block = (FreeBlock*)header;
+		block->next = cache->freeLists[sizeClass];
+		cache->freeLists[sizeClass] = block;
+		cache->numFree[sizeClass]++;
+
+		cache->numFrees[sizeClass].store(cache->numFrees[sizeClass].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+		UINT32 maxCachedBlocks = getMaxCachedBlocks(sizeClass);
+		if(cache->numFree[sizeClass] > maxCachedBlocks)
+			release(cache, sizeClass, maxCachedBlocks / 2);
+	}
+
+	void PoolAllocator::releaseThreadCache()
+	{
+		PoolAllocThreadCache* cache = ActiveCache;
+		if(cache == nullptr)
+			return;
+
+		{
+			BS_LOCK_MUTEX(ThreadCachesMutex);
+
+			auto iterFind = std::find(ThreadCaches->begin(), ThreadCaches->end(), cache);
+			if(iterFind != ThreadCaches->end())
+				ThreadCaches->erase(iterFind);
+
+			// Keep the statistics of the thread around. Done while the mutex is held so getStats
+			// never counts them twice or not at all.
+			for(UINT32 i = 0; i < NUM_SIZE_CLASSES; i++)
+			{
+				SharedPools[i].numRetiredAllocs += cache->numAllocs[i].load();
+				SharedPools[i].numRetiredFrees += cache->numFrees[i].load();
+			}
+		}
+
+		for(UINT32 i = 0; i < NUM_SIZE_CLASSES; i++)
+			release(cache, i, cache->numFree[i]);
+
+		ActiveCache = nullptr;
+		bs_delete(cache);
+	}
+
+	UINT32 PoolAllocator::getNumSizeClasses()
+	{
+		return NUM_SIZE_CLASSES;
+	}
+
+	PoolAllocStats PoolAllocator::getStats(UINT32 sizeClass)
+	{
+		assert(sizeClass < NUM_SIZE_CLASSES);
+
+		PoolAllocStats stats;
+		stats.blockSize = SIZE_CLASSES[sizeClass];
+		stats.numChunks = SharedPools[sizeClass].numChunks.load();
+
+		BS_LOCK_MUTEX(ThreadCachesMutex);
+
+		stats.numAllocs = SharedPools[sizeClass].numRetiredAllocs.load();
+		stats.numFrees = SharedPools[sizeClass].numRetiredFrees.load();
+
+		if(ThreadCaches != nullptr)
+		{
+			for(auto& cache : *ThreadCaches)
+			{
+				stats.numAllocs += cache->numAllocs[sizeClass].load(std::memory_order_relaxed);
+				stats.numFrees += cache->numFrees[sizeClass].load(std::memory_order_relaxed);
+			}
+		}
+
+		return stats;
+	}
+
+	PoolAllocThreadCache* PoolAllocator::getThreadCache()
+	{
+		if(ActiveCache != nullptr)
+			return ActiveCache;
+
+		PoolAllocThreadCache* cache = bs_new<PoolAllocThreadCache>();
+		for(UINT32 i = 0; i < NUM_SIZE_CLASSES; i++)
+		{
+			cache->freeLists[i] = nullptr;
+			cache->numFree[i] = 0;
+			cache->numAllocs[i] = 0;
+			cache->numFrees[i] = 0;
+		}
+
+		{
+			BS_LOCK_MUTEX(ThreadCachesMutex);
+
+			// Never freed, as allocations can still be made during static deinitialization
+			if(ThreadCaches == nullptr)
+				ThreadCaches = bs_new<Vector<PoolAllocThreadCache*>>();
+
+			ThreadCaches->push_back(cache);
+		}
+
+		ActiveCache = cache;
+		return cache;
+	}
+
+	void PoolAllocator::refill(PoolAllocThreadCache* cache, UINT32 sizeClass)
+	{
+		SharedPool& pool = SharedPools[sizeClass];
+		UINT32 maxBlocks = getMaxCachedBlocks(sizeClass) / 2;
+
+		FreeBlock* first = nullptr;
+		FreeBlock* last = nullptr;
+		UINT32 count = 0;
+
+		pool.lock.lock();
+		first = pool.freeList;
+		last = first;
+
+		if(first != nullptr)
+		{
+			count = 1;
+			while(last->next != nullptr && count < maxBlocks)
+			{
+				last = last->next;
+				count++;
+			}
+
+			pool.freeList = last->next;
+		}
+		pool.lock.unlock();
+
+		if(first != nullptr)
+		{
+			last->next = cache->freeLists[sizeClass];
+			cache->freeLists[sizeClass] = first;
+			cache->numFree[sizeClass] += count;
+
+			return;
+		}
+
+		// No free blocks in the shared pool, carve out a new chunk. Chunks are never released back to the OS.
+		UINT32 blockSize = getBlockSize(sizeClass);
+		UINT32 numBlocks = CHUNK_SIZE / blockSize;
+
+		UINT8* chunk = (UINT8*)allocAligned(numBlocks * blockSize);
+		for(UINT32 i = 0; i < numBlocks; i++)
+		{
+			FreeBlock* block = (FreeBlock*)(chunk + i * blockSize);
+			block->next = cache->freeLists[sizeClass];
+			cache->freeLists[sizeClass] = block;
+		}
+
+		cache->numFree[sizeClass] += numBlocks;
+		pool.numChunks++;
+	}
+
+	void PoolAllocator::release(PoolAllocThreadCache* cache, UINT32 sizeClass, UINT32 count)
+	{
+		if(count == 0)
+			return;
+
+		FreeBlock* first = cache->freeLists[sizeClass];
+		FreeBlock* last = first;
+		for(UINT32 i = 1; i < count; i++)
+			last = last->next;
+
+		cache->freeLists[sizeClass] = last->next;
+		cache->numFree[sizeClass] -= count;
+
+		SharedPool& pool = SharedPools[sizeClass];
+
+		pool.lock.lock();
+		last->next = pool.freeList;
+		pool.freeList = first;
+		pool.lock.unlock();
+	}
+}
\ No newline at end of file
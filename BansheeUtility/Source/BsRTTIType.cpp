@@ -7,6 +7,7 @@
 namespace BansheeEngine
 {
 	RTTITypeBase::RTTITypeBase()
+		:mHierarchyRange(0)
 	{ }
 
 	RTTITypeBase::~RTTITypeBase() 
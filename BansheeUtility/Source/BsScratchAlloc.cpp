@@ -0,0 +1,248 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsPrerequisitesUtil.h"
+#include "BsScratchAlloc.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Size of the header placed in front of every allocation.
+	 */
+	static const UINT32 HEADER_SIZE = 16;
+
+	/**
+	 * @brief	Minimum alignment of all returned allocations.
+	 */
+	static const UINT32 MIN_ALIGNMENT = 16;
+
+	/**
+	 * @brief	Default size of a page. Larger allocations get a page of their own.
+	 */
+	static const size_t PAGE_SIZE = 256 * 1024;
+
+	/**
+	 * @brief	Maximum amount of page memory a thread keeps after its outermost scope ends.
+	 */
+	static const size_t MAX_RETAINED_BYTES = 8 * 1024 * 1024;
+
+	/**
+	 * @brief	Value stored in the header of allocations that were made using the OS allocator.
+	 */
+	static const size_t HEAP_ALLOCATION = (size_t)-1;
+
+	/**
+	 * @brief	Header placed in front of every allocation.
+	 */
+	struct ScratchHeader
+	{
+		size_t prevOffset; /**< Page offset before this allocation was made, or HEAP_ALLOCATION. */
+		void* link; /**< Allocation made before this one, or the OS allocated memory for heap allocations. */
+	};
+
+	/**
+	 * @brief	Single block of memory allocations are bump allocated from.
+	 */
+	struct ScratchPage
+	{
+		UINT8* data;
+		size_t size;
+		size_t used;
+	};
+
+	/**
+	 * @brief	Pages and state of the scratch allocator for a single thread.
+	 */
+	struct ScratchArena
+	{
+		Vector<ScratchPage> pages;
+		UINT32 curPage;
+		ScratchScope* activeScope;
+		void* lastAllocation;
+	};
+
+	BS_THREADLOCAL ScratchArena* ScratchAllocator::ActiveArena = nullptr;
+
+	/**
+	 * @brief	Returns the first address at or after the provided one, with the specified alignment.
+	 */
+	static UINT8* alignAddress(UINT8* address, UINT32 alignment)
+	{
+		return (UINT8*)(((size_t)address + alignment - 1) & ~((size_t)alignment - 1));
+	}
+
+	void* ScratchAllocator::allocate(size_t bytes, UINT32 alignment)
+	{
+		assert((alignment & (alignment - 1)) == 0 && "Alignment must be a power of two.");
+
+		if(alignment < MIN_ALIGNMENT)
+			alignment = MIN_ALIGNMENT;
+
+		ScratchArena* arena = ActiveArena;
+		if(arena == nullptr || arena->activeScope == nullptr)
+			return allocateHeap(bytes, alignment);
+
+		size_t requiredSize = bytes + HEADER_SIZE + alignment;
+
+		ScratchPage* page = nullptr;
+		UINT8* data = nullptr;
+		while(true)
+		{
+			if(arena->curPage == (UINT32)arena->pages.size())
+			{
+				ScratchPage newPage;
+				newPage.size = std::max(PAGE_SIZE, requiredSize);
+				newPage.data = (UINT8*)malloc(newPage.size);
+				newPage.used = 0;
+
+				arena->pages.push_back(newPage);
+			}
+
+			page = &arena->pages[arena->curPage];
+			data = alignAddress(page->data + page->used + HEADER_SIZE, alignment);
+
+			if((size_t)(data - page->data) + bytes <= page->size)
+				break;
+
+			// Pages after the current one are always empty. If an empty page is too small replace it
+			// with a larger one, otherwise continue on to the next page.
+			if(page->used == 0)
+			{
+				::free(page->data);
+
+				page->size = std::max(PAGE_SIZE, requiredSize);
+				page->data = (UINT8*)malloc(page->size);
+			}
+			else
+				arena->curPage++;
+		}
+
+		ScratchHeader* header = (ScratchHeader*)(data - HEADER_SIZE);
+		header->prevOffset = page->used;
+		header->link = arena->lastAllocation;
+
+		page->used = (size_t)(data - page->data) + bytes;
+		arena->lastAllocation = data;
+
+		return data;
+	}
+
+	void ScratchAllocator::free(void* ptr)
+	{
+		if(ptr == nullptr)
+			return;
+
+		ScratchHeader* header = (ScratchHeader*)((UINT8*)ptr - HEADER_SIZE);
+		if(header->prevOffset == HEAP_ALLOCATION)
+		{
+			::free(header->link);
+			return;
+		}
+
+		// Only the most recent allocation can be released immediately, anything else gets
+		// released when the scope ends. Memory might also belong to a different thread, in
+		// which case it won't match the last allocation.
+		ScratchArena* arena = ActiveArena;
+		if(arena == nullptr || arena->lastAllocation != ptr)
+			return;
+
+		ScratchScope* scope = arena->activeScope;
+		ScratchPage& page = arena->pages[arena->curPage];
+
+		bool inCurrentPage = (UINT8*)ptr >= page.data && (UINT8*)ptr < (page.data + page.size);
+		bool inCurrentScope = scope != nullptr && (arena->curPage > scope->mPageIdx || header->prevOffset >= scope->mPageOffset);
+
+		if(inCurrentPage && inCurrentScope)
+		{
+			page.used = header->prevOffset;
+			arena->lastAllocation = header->link;
+		}
+		else
+			arena->lastAllocation = nullptr;
+	}
+
+	void ScratchAllocator::releaseThreadMemory()
+	{
+		ScratchArena* arena = ActiveArena;
+		if(arena == nullptr)
+			return;
+
+		assert(arena->activeScope == nullptr && "Releasing scratch memory while a scope is still active.");
+
+		for(auto& page : arena->pages)
+			::free(page.data);
+
+		ActiveArena = nullptr;
+		bs_delete(arena);
+	}
+
+	void* ScratchAllocator::allocateHeap(size_t bytes, UINT32 alignment)
+	{
+		UINT8* allocation = (UINT8*)malloc(bytes + HEADER_SIZE + alignment - 1);
+		UINT8* data = alignAddress(allocation + HEADER_SIZE, alignment);
+
+		ScratchHeader* header = (ScratchHeader*)(data - HEADER_SIZE);
+		header->prevOffset = HEAP_ALLOCATION;
+		header->link = allocation;
+
+		return data;
+	}
+
+	ScratchArena* ScratchAllocator::getArena()
+	{
+		if(ActiveArena == nullptr)
+		{
+			ActiveArena = bs_new<ScratchArena>();
+			ActiveArena->curPage = 0;
+			ActiveArena->activeScope = nullptr;
+			ActiveArena->lastAllocation = nullptr;
+		}
+
+		return ActiveArena;
+	}
+
+	ScratchScope::ScratchScope()
+	{
+		ScratchArena* arena = ScratchAllocator::getArena();
+
+		mParent = arena->activeScope;
+		mPageIdx = arena->curPage;
+		mPageOffset = mPageIdx < (UINT32)arena->pages.size() ? arena->pages[mPageIdx].used : 0;
+		mLastAllocation = arena->lastAllocation;
+
+		arena->activeScope = this;
+	}
+
+	ScratchScope::~ScratchScope()
+	{
+		ScratchArena* arena = ScratchAllocator::ActiveArena;
+		assert(arena->activeScope == this && "Scratch scopes must end in opposite order from which they were started.");
+
+		for(UINT32 i = mPageIdx + 1; i < (UINT32)arena->pages.size(); i++)
+			arena->pages[i].used = 0;
+
+		if(mPageIdx < (UINT32)arena->pages.size())
+			arena->pages[mPageIdx].used = mPageOffset;
+
+		arena->curPage = mPageIdx;
+		arena->lastAllocation = mLastAllocation;
+		arena->activeScope = mParent;
+
+		// Keep the pages for reuse, unless they grew too large because of a few very large temporaries
+		if(mParent == nullptr)
+		{
+			size_t totalSize = 0;
+			for(auto& page : arena->pages)
+				totalSize += page.size;
+
+			while(totalSize > MAX_RETAINED_BYTES && arena->pages.size() > 1)
+			{
+				ScratchPage& page = arena->pages.back();
+				totalSize -= page.size;
+
+				::free(page.data);
+				arena->pages.pop_back();
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -7,16 +7,39 @@
 namespace BansheeEngine
 {
 	Task::Task(const PrivatelyConstruct& dummy, const String& name, std::function<void()> taskWorker, 
-		TaskPriority priority, TaskPtr dependency)
-		:mName(name), mState(0), mPriority(priority), mTaskId(0), 
-		mTaskDependency(dependency), mTaskWorker(taskWorker), mParent(nullptr)
+		TaskPriority priority, const Vector<TaskPtr>& dependencies)
+		:mName(name), mState(0), mPriority(priority), mTaskId(0), mTaskWorker(taskWorker), 
+		mDependencies(dependencies), mNumPendingDependencies(0), mIsFinished(false), mIsResolved(false), mParent(nullptr)
 	{
 
 	}
 
 	TaskPtr Task::create(const String& name, std::function<void()> taskWorker, TaskPriority priority, TaskPtr dependency)
 	{
-		return bs_shared_ptr<Task>(PrivatelyConstruct(), name, taskWorker, priority, dependency);
+		Vector<TaskPtr> dependencies;
+		if (dependency != nullptr)
+			dependencies.push_back(dependency);
+
+		return create(name, taskWorker, priority, dependencies);
+	}
+
+	TaskPtr Task::create(const String& name, std::function<void()> taskWorker, TaskPriority priority, 
+		const Vector<TaskPtr>& dependencies)
+	{
+		TaskPtr task = bs_shared_ptr<Task>(PrivatelyConstruct(), name, taskWorker, priority, dependencies);
+		task->mThis = task;
+
+		return task;
+	}
+
+	TaskPtr Task::then(const String& name, std::function<void()> taskWorker, TaskPriority priority)
+	{
+		TaskPtr continuation = create(name, taskWorker, priority, mThis.lock());
+
+		TaskScheduler* scheduler = mParent != nullptr ? mParent : TaskScheduler::instancePtr();
+		scheduler->addTask(continuation);
+
+		return continuation;
 	}
 
 	bool Task::isComplete() const
@@ -36,65 +59,136 @@ namespace BansheeEngine
 
 	void Task::cancel()
 	{
-		mState.store(3);
+		UINT32 expectedState = 0;
+		mState.compare_exchange_strong(expectedState, 3);
 	}
 
+	bool Task::addSuccessor(const TaskPtr& task)
+	{
+		mSuccessorLock.lock();
+
+		bool isFinished = mIsFinished;
+		if (!isFinished)
+			mSuccessors.push_back(task);
+
+		mSuccessorLock.unlock();
+		return !isFinished;
+	}
+
+	BS_THREADLOCAL TaskScheduler::TaskWorker* TaskScheduler::ActiveWorker = nullptr;
+	BS_THREADLOCAL UINT32 TaskScheduler::ActiveWaitDepth = 0;
+
+	TaskScheduler::TaskWorker::TaskWorker(UINT32 index)
+		:index(index)
+	{ }
+
 	TaskScheduler::TaskScheduler()
-		:mMaxActiveTasks(0), mNumActiveTasks(0), mNextTaskId(0), mShutdown(false),
-		mTaskQueue(&TaskScheduler::taskCompare)
+		:mNumWorkers(0), mMaxActiveTasks(0), mNumQueuedTasks(0), mNumSleepingWorkers(0), 
+		mNumWaitingThreads(0), mNextWorker(0), mNextTaskId(0), mShutdown(false)
 	{
 		mMaxActiveTasks = BS_THREAD_HARDWARE_CONCURRENCY;
 
-		mTaskSchedulerThread = ThreadPool::instance().run("TaskScheduler", std::bind(&TaskScheduler::runMain, this));
+		UINT32 maxWorkers = getMaxNumWorkers();
+		for (UINT32 i = 0; i < maxWorkers; i++)
+			mWorkers.push_back(bs_new<TaskWorker>(i));
 	}
 
 	TaskScheduler::~TaskScheduler()
 	{
-		// Wait until all tasks complete
-		BS_LOCK_MUTEX_NAMED(mActiveTaskMutex, activeTaskLock);
-
-		while (mActiveTasks.size() > 0)
+		// Stop the workers. They will finish their current task and exit, any tasks still in queue are canceled.
 		{
-			TaskPtr task = mActiveTasks[0];
-			activeTaskLock.unlock();
-
-			task->wait();
-			activeTaskLock.lock();
+			BS_LOCK_MUTEX(mReadyMutex);
+			mShutdown = true;
 		}
 
-		// Start shutdown of the main queue worker and wait until it exits
+		BS_THREAD_NOTIFY_ALL(mTaskReadyCond);
+		BS_THREAD_NOTIFY_ALL(mWorkerActiveCond);
+
+		// No new workers will be spawned after the shutdown flag is set
+		UINT32 numWorkers = 0;
 		{
-			BS_LOCK_MUTEX(mReadyMutex);
+			BS_LOCK_MUTEX(mWorkerMutex);
+			numWorkers = mNumWorkers.load();
+		}
 
-			mShutdown = true;
+		for (UINT32 i = 0; i < numWorkers; i++)
+			mWorkers[i]->thread.blockUntilComplete();
+
+		// Cancel the remaining tasks so that anyone waiting on them is released. Canceling a task also
+		// cancels and queues its successors, so keep going until the queues are empty.
+		while (mNumQueuedTasks.load() > 0)
+		{
+			for (auto& worker : mWorkers)
+			{
+				TaskPtr task;
+				while (popTask(worker, true, task))
+				{
+					task->cancel();
+					finishTask(task);
+				}
+			}
 		}
 
-		BS_THREAD_NOTIFY_ONE(mTaskReadyCond);
+		notifyTaskComplete();
 
-		mTaskSchedulerThread.blockUntilComplete();
+		for (auto& worker : mWorkers)
+			bs_delete(worker);
 	}
 
 	void TaskScheduler::addTask(const TaskPtr& task)
 	{
-		BS_LOCK_MUTEX(mReadyMutex);
-
 		task->mParent = this;
 		task->mTaskId = mNextTaskId++;
 
-		mTaskQueue.insert(task);
+		spawnWorkers();
+
+		// Hold an extra count while registering, so the dependencies completing in the meantime can't queue the task
+		task->mNumPendingDependencies = 1;
+		for (auto& dependency : task->mDependencies)
+		{
+			task->mNumPendingDependencies++;
+
+			if (!dependency->addSuccessor(task))
+			{
+				if (dependency->isCanceled())
+					task->cancel();
+
+				task->mNumPendingDependencies--;
+			}
+		}
+
+		// Dependencies hold a reference to the task from now on, we don't need to reference them back
+		task->mDependencies.clear();
+
+		if (--task->mNumPendingDependencies == 0)
+			queueReadyTask(task);
+	}
+
+	void TaskScheduler::queueReadyTask(const TaskPtr& task)
+	{
+		// Tasks queued from a worker go to its own queue, otherwise distribute them over available workers
+		TaskWorker* worker = ActiveWorker;
+		if (worker == nullptr)
+		{
+			UINT32 numWorkers = std::max(1U, mNumWorkers.load());
+			worker = mWorkers[mNextWorker++ % numWorkers];
+		}
 
-		// Wake main scheduler thread
-		BS_THREAD_NOTIFY_ONE(mTaskReadyCond);
+		pushTask(worker, task);
 	}
 
 	void TaskScheduler::addWorker()
 	{
-		BS_LOCK_MUTEX(mReadyMutex);
+		{
+			BS_LOCK_MUTEX(mReadyMutex);
+			mMaxActiveTasks++;
+		}
 
-		mMaxActiveTasks++;
+		// A spot freed up, wake a waiting worker, or create a new one if needed
+		BS_THREAD_NOTIFY_ALL(mWorkerActiveCond);
 
-		// A spot freed up, queue new tasks on main scheduler thread if they exist
-		BS_THREAD_NOTIFY_ONE(mTaskReadyCond);
+		if (mNumQueuedTasks.load() > 0)
+			spawnWorkers();
 	}
 
 	void TaskScheduler::removeWorker()
@@ -105,91 +199,266 @@ namespace BansheeEngine
 			mMaxActiveTasks--;
 	}
 
-	void TaskScheduler::runMain()
+	UINT32 TaskScheduler::getNumWorkers() const
 	{
-		while(true)
-		{
-			BS_LOCK_MUTEX_NAMED(mReadyMutex, lock);
+		return mMaxActiveTasks.load();
+	}
 
-			while((mTaskQueue.size() == 0 || mNumActiveTasks == mMaxActiveTasks) && !mShutdown)
-				BS_THREAD_WAIT(mTaskReadyCond, mReadyMutex, lock);
+	UINT32 TaskScheduler::getMaxNumWorkers()
+	{
+		// Allow for some extra workers, as they get added whenever a thread blocks
+		return std::max(1U, (UINT32)BS_THREAD_HARDWARE_CONCURRENCY * 2);
+	}
 
-			if(mShutdown)
+	void TaskScheduler::runWorker(TaskWorker* worker)
+	{
+		ActiveWorker = worker;
+
+		while(true)
+		{
+			if (mShutdown.load())
 				break;
 
-			for(UINT32 i = 0; (i < mTaskQueue.size()) && (mNumActiveTasks < mMaxActiveTasks); i++)
+			if (worker->index >= mMaxActiveTasks.load())
 			{
-				TaskPtr curTask = *mTaskQueue.begin();
-				mTaskQueue.erase(mTaskQueue.begin());
+				BS_LOCK_MUTEX_NAMED(mReadyMutex, lock);
 
-				if(curTask->isCanceled())
-					continue;
+				// We might have been woken up for a task, pass the notification on to someone else
+				if (mNumQueuedTasks.load() > 0)
+					BS_THREAD_NOTIFY_ONE(mTaskReadyCond);
 
-				if(curTask->mTaskDependency != nullptr && !curTask->mTaskDependency->isComplete())
-					continue;
+				while (worker->index >= mMaxActiveTasks.load() && !mShutdown.load())
+					BS_THREAD_WAIT(mWorkerActiveCond, mReadyMutex, lock);
 
-				BS_LOCK_MUTEX(mActiveTaskMutex);
-				{
-					curTask->mState.store(1);
-					mActiveTasks.push_back(curTask);
-					mNumActiveTasks++;
-				}
+				continue;
+			}
 
-				ThreadPool::instance().run(curTask->mName, std::bind(&TaskScheduler::runTask, this, curTask));
+			TaskPtr task;
+			if (findTask(worker, task))
+			{
+				runTask(task);
+				continue;
+			}
+
+			{
+				BS_LOCK_MUTEX_NAMED(mReadyMutex, lock);
+
+				mNumSleepingWorkers++;
+				while (mNumQueuedTasks.load() == 0 && worker->index < mMaxActiveTasks.load() && !mShutdown.load())
+					BS_THREAD_WAIT(mTaskReadyCond, mReadyMutex, lock);
+				mNumSleepingWorkers--;
 			}
 		}
+
+		ActiveWorker = nullptr;
 	}
 
-	void TaskScheduler::runTask(TaskPtr task)
+	void TaskScheduler::runTask(const TaskPtr& task)
 	{
-		task->mTaskWorker();
-
+		UINT32 expectedState = 0;
+		if (task->mState.compare_exchange_strong(expectedState, 1))
 		{
-			BS_LOCK_MUTEX(mActiveTaskMutex);
+			if (task->mTaskWorker != nullptr)
+				task->mTaskWorker();
 
-			auto findIter = std::find(mActiveTasks.begin(), mActiveTasks.end(), task);
-			if (findIter != mActiveTasks.end())
-				mActiveTasks.erase(findIter);
+			task->mState.store(2);
 		}
 
+		finishTask(task);
+		notifyTaskComplete();
+	}
+
+	void TaskScheduler::finishTask(const TaskPtr& task)
+	{
+		Vector<TaskPtr> successors;
+
+		task->mSuccessorLock.lock();
+		task->mIsFinished = true;
+		std::swap(successors, task->mSuccessors);
+		task->mSuccessorLock.unlock();
+
+		bool isCanceled = task->isCanceled();
+		for (auto& successor : successors)
 		{
-			BS_LOCK_MUTEX(mCompleteMutex);
-			task->mState.store(2);
+			if (isCanceled)
+				successor->cancel();
 
-			BS_THREAD_NOTIFY_ALL(mTaskCompleteCond);
+			// Canceled successors still get queued, so they can in turn cancel their own successors when dequeued
+			if (--successor->mNumPendingDependencies == 0)
+				queueReadyTask(successor);
 		}
 
-		// Possibly this task was someones dependency, so wake the main scheduler thread
-		BS_THREAD_NOTIFY_ONE(mTaskReadyCond);
+		task->mIsResolved.store(true);
 	}
 
-	void TaskScheduler::waitUntilComplete(const Task* task)
+	bool TaskScheduler::tryRunTask()
 	{
-		if(task->isCanceled())
-			return;
+		TaskPtr task;
+		if (!findTask(ActiveWorker, task))
+			return false;
 
+		runTask(task);
+		return true;
+	}
+
+	bool TaskScheduler::findTask(TaskWorker* worker, TaskPtr& task)
+	{
+		UINT32 numWorkers = mNumWorkers.load();
+		UINT32 numQueues = std::max(1U, numWorkers);
+		UINT32 start = worker != nullptr ? worker->index : 0;
+
+		for (UINT32 i = 0; i < numQueues; i++)
 		{
-			BS_LOCK_MUTEX_NAMED(mCompleteMutex, lock);
-			
-			while(!task->isComplete())
+			TaskWorker* curWorker = mWorkers[(start + i) % numQueues];
+			bool steal = curWorker != worker;
+
+			while (popTask(curWorker, steal, task))
 			{
-				addWorker();
-				BS_THREAD_WAIT(mTaskCompleteCond, mCompleteMutex, lock);
-				removeWorker();
+				if (task->isCanceled())
+				{
+					finishTask(task);
+					notifyTaskComplete();
+					continue;
+				}
+
+				return true;
 			}
 		}
+
+		return false;
 	}
 
-	bool TaskScheduler::taskCompare(const TaskPtr& lhs, const TaskPtr& rhs)
+	bool TaskScheduler::popTask(TaskWorker* worker, bool steal, TaskPtr& task)
 	{
-		// If one tasks priority is higher, that one goes first
-		if(lhs->mPriority > rhs->mPriority)
-			return true;
+		if (mNumQueuedTasks.load() == 0)
+			return false;
+
+		worker->lock.lock();
 
-		// Otherwise we go by smaller id, as that task was queued earlier than the other
-		if(lhs->mTaskId < rhs->mTaskId)
+		for (INT32 i = NUM_PRIORITIES - 1; i >= 0; i--)
+		{
+			Deque<TaskPtr>& queue = worker->queues[i];
+			if (queue.empty())
+				continue;
+
+			if (steal)
+			{
+				task = queue.front();
+				queue.pop_front();
+			}
+			else
+			{
+				task = queue.back();
+				queue.pop_back();
+			}
+
+			worker->lock.unlock();
+
+			mNumQueuedTasks--;
 			return true;
+		}
+
+		worker->lock.unlock();
+		return false;
+	}
+
+	void TaskScheduler::pushTask(TaskWorker* worker, const TaskPtr& task)
+	{
+		UINT32 priorityIdx = getPriorityIdx(task->mPriority);
 
-		BS_EXCEPT(InternalErrorException, "Found two identical tasks.");
+		// Increment before the task is visible, so the count never underflows
+		mNumQueuedTasks++;
+
+		worker->lock.lock();
+		worker->queues[priorityIdx].push_back(task);
+		worker->lock.unlock();
+
+		// Wake a sleeping worker, if any. Sleeping workers increment the counter before checking
+		// the number of queued tasks, so we can't miss one.
+		if (mNumSleepingWorkers.load() > 0)
+		{
+			BS_LOCK_MUTEX(mReadyMutex);
+			BS_THREAD_NOTIFY_ONE(mTaskReadyCond);
+		}
+	}
+
+	void TaskScheduler::spawnWorkers()
+	{
+		UINT32 numRequired = std::min(mMaxActiveTasks.load(), (UINT32)mWorkers.size());
+		if (mNumWorkers.load() >= numRequired)
+			return;
+
+		BS_LOCK_MUTEX(mWorkerMutex);
+
+		UINT32 numWorkers = mNumWorkers.load();
+		if (mShutdown.load())
+			return;
+
+		for (UINT32 i = numWorkers; i < numRequired; i++)
+		{
+			TaskWorker* worker = mWorkers[i];
+			worker->thread = ThreadPool::instance().run("TaskWorker", std::bind(&TaskScheduler::runWorker, this, worker));
+
+			mNumWorkers.store(i + 1);
+		}
+	}
+
+	UINT32 TaskScheduler::getPriorityIdx(TaskPriority priority)
+	{
+		UINT32 priorityIdx = (UINT32)priority - (UINT32)TaskPriority::VeryLow;
+		return std::min(priorityIdx, NUM_PRIORITIES - 1);
+	}
+
+	void TaskScheduler::notifyTaskComplete()
+	{
+		// Waiting threads increment the counter before checking task state, so we can't miss one
+		if (mNumWaitingThreads.load() > 0)
+		{
+			BS_LOCK_MUTEX(mCompleteMutex);
+			BS_THREAD_NOTIFY_ALL(mTaskCompleteCond);
+		}
+	}
+
+	void TaskScheduler::waitUntilComplete(const Task* task)
+	{
+		bool isWorker = ActiveWorker != nullptr;
+		while (!task->mIsResolved.load())
+		{
+			// Workers help out with other tasks while they wait
+			if (isWorker && ActiveWaitDepth < MAX_NESTED_WAITS)
+			{
+				ActiveWaitDepth++;
+				bool ranTask = tryRunTask();
+				ActiveWaitDepth--;
+
+				if (ranTask)
+					continue;
+			}
+
+			// Let another worker use our core while we're blocked
+			addWorker();
+
+			{
+				BS_LOCK_MUTEX_NAMED(mCompleteMutex, lock);
+
+				mNumWaitingThreads++;
+				
+				// Workers wake up after any task completes, as new tasks they can help with might have been queued
+				if (isWorker)
+				{
+					if (!task->mIsResolved.load())
+						BS_THREAD_WAIT(mTaskCompleteCond, mCompleteMutex, lock);
+				}
+				else
+				{
+					while (!task->mIsResolved.load())
+						BS_THREAD_WAIT(mTaskCompleteCond, mCompleteMutex, lock);
+				}
+
+				mNumWaitingThreads--;
+			}
+
+			removeWorker();
+		}
 	}
 }
\ No newline at end of file
@@ -236,6 +236,7 @@ namespace BansheeEngine
 			while (width < currentElem.input.width || height < currentElem.input.height)
 				return -1;
 
+			ScratchScope scratchScope; // Node tree is only needed while filling this page
 			TexAtlasNode atlasNode(0, 0, width, height);
 			atlasNode.insert(elements[largestTexId]);
 			elements[largestTexId].output.page = currentPage;
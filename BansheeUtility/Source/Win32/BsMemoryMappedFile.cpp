@@ -0,0 +1,66 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsMemoryMappedFile.h"
+#include "BsException.h"
+#include "BsPath.h"
+#include <windows.h>
+
+namespace BansheeEngine
+{
+	MemoryMappedFile::MemoryMappedFile(const Path& fullPath)
+		:mData(nullptr), mSize(0), mFileHandle(INVALID_HANDLE_VALUE), mMappingHandle(nullptr)
+	{
+		WString path = fullPath.toWString();
+
+		HANDLE fileHandle = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, 
+			OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+		if(fileHandle == INVALID_HANDLE_VALUE)
+			BS_EXCEPT(FileNotFoundException, "Cannot open file: " + fullPath.toString());
+
+		mFileHandle = fileHandle;
+
+		LARGE_INTEGER fileSize;
+		if(!GetFileSizeEx(fileHandle, &fileSize))
+		{
+			CloseHandle(fileHandle);
+			BS_EXCEPT(IOException, "Cannot retrieve size of file: " + fullPath.toString());
+		}
+
+		mSize = (UINT64)fileSize.QuadPart;
+
+		// Empty files cannot be mapped
+		if(mSize == 0)
+			return;
+
+		HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if(mappingHandle == nullptr)
+		{
+			CloseHandle(fileHandle);
+			BS_EXCEPT(IOException, "Cannot map file: " + fullPath.toString());
+		}
+
+		mMappingHandle = mappingHandle;
+
+		mData = (UINT8*)MapViewOfFile(mappingHandle, FILE_MAP_COPY, 0, 0, 0);
+		if(mData == nullptr)
+		{
+			CloseHandle(mappingHandle);
+			CloseHandle(fileHandle);
+			BS_EXCEPT(IOException, "Cannot map file: " + fullPath.toString());
+		}
+	}
+
+	MemoryMappedFile::~MemoryMappedFile()
+	{
+		if(mData != nullptr)
+			UnmapViewOfFile(mData);
+
+		if(mMappingHandle != nullptr)
+			CloseHandle((HANDLE)mMappingHandle);
+
+		if(mFileHandle != INVALID_HANDLE_VALUE)
+			CloseHandle((HANDLE)mFileHandle);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Helper methods for timing benchmarked operations and printing their results.
+	 */
+	class Benchmark
+	{
+	public:
+		/**
+		 * @brief	Executes the provided method "numRuns" times and returns the duration of the
+		 *			fastest run, in seconds.
+		 *
+		 * @param	method		Method to measure.
+		 * @param	numRuns		Number of times to execute the method.
+		 * @param	prepare		(optional) Method called before each run. Not included in the measured time.
+		 * @param	cleanUp		(optional) Method called after each run. Not included in the measured time.
+		 */
+		static double measure(const std::function<void()>& method, UINT32 numRuns,
+			const std::function<void()>& prepare = nullptr, const std::function<void()>& cleanUp = nullptr);
+
+		/**
+		 * @brief	Prints a title of a group of benchmarks.
+		 */
+		static void printTitle(const String& title);
+
+		/**
+		 * @brief	Prints the duration of an operation that processed the provided number of bytes and objects,
+		 *			along with the throughput in MB/s and objects/s.
+		 */
+		static void printThroughput(const String& name, double seconds, UINT64 numBytes, UINT64 numObjects);
+
+		/**
+		 * @brief	Prints the duration of an operation that processed the provided number of items, along with
+		 *			the number of items processed per second.
+		 *
+		 * @param	name		Name of the operation.
+		 * @param	seconds		Duration of the operation.
+		 * @param	count		Number of processed items.
+		 * @param	itemName	Name of a single item, used for labeling the rate (e.g. "tasks").
+		 */
+		static void printRate(const String& name, double seconds, UINT64 count, const String& itemName);
+
+		/**
+		 * @brief	Prints a line of arbitrary text.
+		 */
+		static void printLine(const String& text);
+
+		static const UINT32 NUM_RUNS = 5;
+	};
+
+	/**
+	 * @brief	Measures MemorySerializer and FileSerializer performance on synthetic object graphs,
+	 *			a large SceneObject hierarchy and large mesh and pixel data objects.
+	 */
+	void runSerializationBenchmarks();
+
+	/**
+	 * @brief	Measures TaskScheduler and parallelFor throughput, and compares it with dispatching
+	 *			work directly on ThreadPool threads.
+	 */
+	void runTaskSchedulerBenchmarks();
+
+	/**
+	 * @brief	Measures throughput of the different command queue implementations.
+	 */
+	void runCommandQueueBenchmarks();
+}
\ No newline at end of file
@@ -0,0 +1,129 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+#include "BsIReflectable.h"
+
+namespace BansheeEngine
+{
+	enum TypeID_Benchmark
+	{
+		TID_BenchmarkNode = 40000,
+		TID_BenchmarkArrays = 40001,
+		TID_BenchmarkDataBlock = 40002
+	};
+
+	/**
+	 * @brief	Serializable object containing a single large block of raw data.
+	 */
+	class BenchmarkDataBlock : public IReflectable
+	{
+	public:
+		BenchmarkDataBlock();
+
+		/**
+		 * @brief	Creates a new data block of the specified size, filled with a repeating pattern.
+		 */
+		static std::shared_ptr<BenchmarkDataBlock> create(UINT32 size);
+
+	private:
+		Vector<UINT8> mData;
+
+		/************************************************************************/
+		/* 								SERIALIZATION                      		*/
+		/************************************************************************/
+	public:
+		friend class BenchmarkDataBlockRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		virtual RTTITypeBase* getRTTI() const;
+	};
+
+	/**
+	 * @brief	Serializable object containing large arrays of plain values and strings.
+	 */
+	class BenchmarkArrays : public IReflectable
+	{
+	public:
+		BenchmarkArrays();
+
+		/**
+		 * @brief	Creates a new object with "numValues" integers and floats, and "numStrings" strings.
+		 */
+		static std::shared_ptr<BenchmarkArrays> create(UINT32 numValues, UINT32 numStrings);
+
+	private:
+		Vector<UINT32> mIntegers;
+		Vector<float> mFloats;
+		Vector<String> mStrings;
+
+		/************************************************************************/
+		/* 								SERIALIZATION                      		*/
+		/************************************************************************/
+	public:
+		friend class BenchmarkArraysRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		virtual RTTITypeBase* getRTTI() const;
+	};
+
+	/**
+	 * @brief	Serializable node used for building synthetic object graphs. Each node owns its children,
+	 *			and may additionally reference any number of nodes owned by other nodes.
+	 */
+	class BenchmarkNode : public IReflectable
+	{
+	public:
+		BenchmarkNode();
+
+		/**
+		 * @brief	Creates a hierarchy of nodes where each node, up to the specified depth, has "numChildren" children.
+		 *
+		 * @param	depth			Number of levels in the hierarchy, including the root node.
+		 * @param	numChildren		Number of children of each non-leaf node.
+		 * @param	numObjects		Output parameter receiving the total number of created objects.
+		 */
+		static std::shared_ptr<BenchmarkNode> createHierarchy(UINT32 depth, UINT32 numChildren, UINT64& numObjects);
+
+		/**
+		 * @brief	Creates a single node holding an object with large plain value and string arrays.
+		 *
+		 * @see		BenchmarkArrays::create
+		 */
+		static std::shared_ptr<BenchmarkNode> createArrays(UINT32 numValues, UINT32 numStrings, UINT64& numObjects);
+
+		/**
+		 * @brief	Creates a node with "numNodes" leaf children, and "numNodes" additional children that each
+		 *			reference "numReferences" of the leaf children, so most of the pointers in the graph point to
+		 *			objects that were already serialized.
+		 */
+		static std::shared_ptr<BenchmarkNode> createReferenceGraph(UINT32 numNodes, UINT32 numReferences, UINT64& numObjects);
+
+		/**
+		 * @brief	Creates a single node holding "numBlocks" data blocks of "blockSize" bytes each.
+		 */
+		static std::shared_ptr<BenchmarkNode> createDataBlocks(UINT32 numBlocks, UINT32 blockSize, UINT64& numObjects);
+
+	private:
+		UINT32 mId;
+		float mWeight;
+		String mName;
+		Vector<std::shared_ptr<BenchmarkNode>> mChildren;
+		Vector<std::shared_ptr<BenchmarkNode>> mReferences;
+		Vector<std::shared_ptr<BenchmarkArrays>> mArrays;
+		Vector<std::shared_ptr<BenchmarkDataBlock>> mDataBlocks;
+
+		/**
+		 * @brief	Creates a new node with the provided identifier and a name and weight derived from it.
+		 */
+		static std::shared_ptr<BenchmarkNode> createNode(UINT32 id);
+
+		/************************************************************************/
+		/* 								SERIALIZATION                      		*/
+		/************************************************************************/
+	public:
+		friend class BenchmarkNodeRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		virtual RTTITypeBase* getRTTI() const;
+	};
+}
\ No newline at end of file
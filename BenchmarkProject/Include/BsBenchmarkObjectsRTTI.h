@@ -0,0 +1,169 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+#include "BsRTTIType.h"
+#include "BsManagedDataBlock.h"
+#include "BsBenchmarkObjects.h"
+
+namespace BansheeEngine
+{
+	class BenchmarkDataBlockRTTI : public RTTIType<BenchmarkDataBlock, IReflectable, BenchmarkDataBlockRTTI>
+	{
+	private:
+		ManagedDataBlock getData(BenchmarkDataBlock* obj)
+		{
+			ManagedDataBlock dataBlock(obj->mData.data(), (UINT32)obj->mData.size());
+			return dataBlock;
+		}
+
+		void setData(BenchmarkDataBlock* obj, ManagedDataBlock val)
+		{
+			// Data was already written into the buffer returned by allocateData
+		}
+
+		static UINT8* allocateData(BenchmarkDataBlock* obj, UINT32 numBytes)
+		{
+			obj->mData.resize(numBytes);
+
+			return obj->mData.data();
+		}
+
+	public:
+		BenchmarkDataBlockRTTI()
+		{
+			addDataBlockField("mData", 0, &BenchmarkDataBlockRTTI::getData, &BenchmarkDataBlockRTTI::setData, 0,
+				&BenchmarkDataBlockRTTI::allocateData);
+		}
+
+		virtual const String& getRTTIName()
+		{
+			static String name = "BenchmarkDataBlock";
+			return name;
+		}
+
+		virtual UINT32 getRTTIId()
+		{
+			return TID_BenchmarkDataBlock;
+		}
+
+		virtual std::shared_ptr<IReflectable> newRTTIObject()
+		{
+			return bs_shared_ptr<BenchmarkDataBlock>();
+		}
+	};
+
+	class BenchmarkArraysRTTI : public RTTIType<BenchmarkArrays, IReflectable, BenchmarkArraysRTTI>
+	{
+	private:
+		UINT32& getInteger(BenchmarkArrays* obj, UINT32 arrayIdx) { return obj->mIntegers[arrayIdx]; }
+		void setInteger(BenchmarkArrays* obj, UINT32 arrayIdx, UINT32& value) { obj->mIntegers[arrayIdx] = value; }
+		UINT32 getNumIntegers(BenchmarkArrays* obj) { return (UINT32)obj->mIntegers.size(); }
+		void setNumIntegers(BenchmarkArrays* obj, UINT32 numEntries) { obj->mIntegers.resize(numEntries); }
+
+		float& getFloat(BenchmarkArrays* obj, UINT32 arrayIdx) { return obj->mFloats[arrayIdx]; }
+		void setFloat(BenchmarkArrays* obj, UINT32 arrayIdx, float& value) { obj->mFloats[arrayIdx] = value; }
+		UINT32 getNumFloats(BenchmarkArrays* obj) { return (UINT32)obj->mFloats.size(); }
+		void setNumFloats(BenchmarkArrays* obj, UINT32 numEntries) { obj->mFloats.resize(numEntries); }
+
+		String& getString(BenchmarkArrays* obj, UINT32 arrayIdx) { return obj->mStrings[arrayIdx]; }
+		void setString(BenchmarkArrays* obj, UINT32 arrayIdx, String& value) { obj->mStrings[arrayIdx] = value; }
+		UINT32 getNumStrings(BenchmarkArrays* obj) { return (UINT32)obj->mStrings.size(); }
+		void setNumStrings(BenchmarkArrays* obj, UINT32 numEntries) { obj->mStrings.resize(numEntries); }
+
+	public:
+		BenchmarkArraysRTTI()
+		{
+			addPlainArrayField("mIntegers", 0, &BenchmarkArraysRTTI::getInteger, &BenchmarkArraysRTTI::getNumIntegers,
+				&BenchmarkArraysRTTI::setInteger, &BenchmarkArraysRTTI::setNumIntegers);
+			addPlainArrayField("mFloats", 1, &BenchmarkArraysRTTI::getFloat, &BenchmarkArraysRTTI::getNumFloats,
+				&BenchmarkArraysRTTI::setFloat, &BenchmarkArraysRTTI::setNumFloats);
+			addPlainArrayField("mStrings", 2, &BenchmarkArraysRTTI::getString, &BenchmarkArraysRTTI::getNumStrings,
+				&BenchmarkArraysRTTI::setString, &BenchmarkArraysRTTI::setNumStrings);
+		}
+
+		virtual const String& getRTTIName()
+		{
+			static String name = "BenchmarkArrays";
+			return name;
+		}
+
+		virtual UINT32 getRTTIId()
+		{
+			return TID_BenchmarkArrays;
+		}
+
+		virtual std::shared_ptr<IReflectable> newRTTIObject()
+		{
+			return bs_shared_ptr<BenchmarkArrays>();
+		}
+	};
+
+	class BenchmarkNodeRTTI : public RTTIType<BenchmarkNode, IReflectable, BenchmarkNodeRTTI>
+	{
+	private:
+		UINT32& getId(BenchmarkNode* obj) { return obj->mId; }
+		void setId(BenchmarkNode* obj, UINT32& val) { obj->mId = val; }
+
+		float& getWeight(BenchmarkNode* obj) { return obj->mWeight; }
+		void setWeight(BenchmarkNode* obj, float& val) { obj->mWeight = val; }
+
+		String& getName(BenchmarkNode* obj) { return obj->mName; }
+		void setName(BenchmarkNode* obj, String& val) { obj->mName = val; }
+
+		std::shared_ptr<BenchmarkNode> getChild(BenchmarkNode* obj, UINT32 idx) { return obj->mChildren[idx]; }
+		void setChild(BenchmarkNode* obj, UINT32 idx, std::shared_ptr<BenchmarkNode> val) { obj->mChildren[idx] = val; }
+		UINT32 getNumChildren(BenchmarkNode* obj) { return (UINT32)obj->mChildren.size(); }
+		void setNumChildren(BenchmarkNode* obj, UINT32 size) { obj->mChildren.resize(size); }
+
+		std::shared_ptr<BenchmarkNode> getReference(BenchmarkNode* obj, UINT32 idx) { return obj->mReferences[idx]; }
+		void setReference(BenchmarkNode* obj, UINT32 idx, std::shared_ptr<BenchmarkNode> val) { obj->mReferences[idx] = val; }
+		UINT32 getNumReferences(BenchmarkNode* obj) { return (UINT32)obj->mReferences.size(); }
+		void setNumReferences(BenchmarkNode* obj, UINT32 size) { obj->mReferences.resize(size); }
+
+		std::shared_ptr<BenchmarkArrays> getArrays(BenchmarkNode* obj, UINT32 idx) { return obj->mArrays[idx]; }
+		void setArrays(BenchmarkNode* obj, UINT32 idx, std::shared_ptr<BenchmarkArrays> val) { obj->mArrays[idx] = val; }
+		UINT32 getNumArrays(BenchmarkNode* obj) { return (UINT32)obj->mArrays.size(); }
+		void setNumArrays(BenchmarkNode* obj, UINT32 size) { obj->mArrays.resize(size); }
+
+		std::shared_ptr<BenchmarkDataBlock> getDataBlock(BenchmarkNode* obj, UINT32 idx) { return obj->mDataBlocks[idx]; }
+		void setDataBlock(BenchmarkNode* obj, UINT32 idx, std::shared_ptr<BenchmarkDataBlock> val) { obj->mDataBlocks[idx] = val; }
+		UINT32 getNumDataBlocks(BenchmarkNode* obj) { return (UINT32)obj->mDataBlocks.size(); }
+		void setNumDataBlocks(BenchmarkNode* obj, UINT32 size) { obj->mDataBlocks.resize(size); }
+
+	public:
+		BenchmarkNodeRTTI()
+		{
+			addPlainField("mId", 0, &BenchmarkNodeRTTI::getId, &BenchmarkNodeRTTI::setId);
+			addPlainField("mWeight", 1, &BenchmarkNodeRTTI::getWeight, &BenchmarkNodeRTTI::setWeight);
+			addPlainField("mName", 2, &BenchmarkNodeRTTI::getName, &BenchmarkNodeRTTI::setName);
+
+			addReflectablePtrArrayField("mChildren", 3, &BenchmarkNodeRTTI::getChild,
+				&BenchmarkNodeRTTI::getNumChildren, &BenchmarkNodeRTTI::setChild, &BenchmarkNodeRTTI::setNumChildren);
+			addReflectablePtrArrayField("mReferences", 4, &BenchmarkNodeRTTI::getReference,
+				&BenchmarkNodeRTTI::getNumReferences, &BenchmarkNodeRTTI::setReference, &BenchmarkNodeRTTI::setNumReferences);
+			addReflectablePtrArrayField("mArrays", 5, &BenchmarkNodeRTTI::getArrays,
+				&BenchmarkNodeRTTI::getNumArrays, &BenchmarkNodeRTTI::setArrays, &BenchmarkNodeRTTI::setNumArrays);
+			addReflectablePtrArrayField("mDataBlocks", 6, &BenchmarkNodeRTTI::getDataBlock,
+				&BenchmarkNodeRTTI::getNumDataBlocks, &BenchmarkNodeRTTI::setDataBlock, &BenchmarkNodeRTTI::setNumDataBlocks);
+		}
+
+		virtual const String& getRTTIName()
+		{
+			static String name = "BenchmarkNode";
+			return name;
+		}
+
+		virtual UINT32 getRTTIId()
+		{
+			return TID_BenchmarkNode;
+		}
+
+		virtual std::shared_ptr<IReflectable> newRTTIObject()
+		{
+			return bs_shared_ptr<BenchmarkNode>();
+		}
+	};
+}
\ No newline at end of file
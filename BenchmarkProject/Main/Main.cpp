@@ -0,0 +1,52 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsCorePrerequisites.h"
+#include "BsMemStack.h"
+#include "BsThreadPool.h"
+#include "BsTaskScheduler.h"
+#include "BsCoreThread.h"
+#include "BsGameObjectManager.h"
+#include "BsCoreSceneManager.h"
+
+#include "BsBenchmark.h"
+
+using namespace BansheeEngine;
+
+/**
+ * Starts up the minimal set of modules needed for serialization, task scheduling and command queues, without
+ * a render system or a window, runs all benchmarks and prints the results to the console.
+ *
+ * Benchmarks should be run in Release configuration. To compare against an older implementation build this
+ * project against an earlier revision of the engine.
+ */
+int main()
+{
+	MemStack::beginThread();
+
+	UINT32 numWorkerThreads = BS_THREAD_HARDWARE_CONCURRENCY - 1; // Number of cores while excluding current thread.
+
+	// Pool needs to provide the scheduler workers, the core thread and threads used directly by the benchmarks
+	UINT32 maxNumThreads = TaskScheduler::getMaxNumWorkers() + 2 * BS_THREAD_HARDWARE_CONCURRENCY + 2;
+
+	ThreadPool::startUp<TThreadPool<ThreadBansheePolicy>>(numWorkerThreads, maxNumThreads);
+	TaskScheduler::startUp();
+	TaskScheduler::instance().removeWorker();
+	CoreThread::startUp();
+	GameObjectManager::startUp();
+	CoreSceneManager::startUp();
+
+	runSerializationBenchmarks();
+	runTaskSchedulerBenchmarks();
+	runCommandQueueBenchmarks();
+
+	CoreSceneManager::shutDown();
+	GameObjectManager::shutDown();
+	CoreThread::shutDown();
+	TaskScheduler::shutDown();
+	ThreadPool::shutDown();
+
+	MemStack::endThread();
+
+	return 0;
+}
\ No newline at end of file
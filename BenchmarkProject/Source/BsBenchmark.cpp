@@ -0,0 +1,65 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsBenchmark.h"
+#include "BsTimer.h"
+
+#include <iostream>
+#include <iomanip>
+
+namespace BansheeEngine
+{
+	double Benchmark::measure(const std::function<void()>& method, UINT32 numRuns,
+		const std::function<void()>& prepare, const std::function<void()>& cleanUp)
+	{
+		double fastest = std::numeric_limits<double>::max();
+
+		Timer timer;
+		for (UINT32 i = 0; i < numRuns; i++)
+		{
+			if (prepare != nullptr)
+				prepare();
+
+			timer.reset();
+			method();
+			double seconds = timer.getMicroseconds() / 1000000.0;
+
+			if (cleanUp != nullptr)
+				cleanUp();
+
+			fastest = std::min(fastest, seconds);
+		}
+
+		return fastest;
+	}
+
+	void Benchmark::printTitle(const String& title)
+	{
+		std::cout << std::endl << "=== " << title << " ===" << std::endl;
+	}
+
+	void Benchmark::printThroughput(const String& name, double seconds, UINT64 numBytes, UINT64 numObjects)
+	{
+		double safeSeconds = std::max(seconds, 0.000001);
+		double megabytes = numBytes / (1024.0 * 1024.0);
+
+		std::cout << std::left << std::setw(48) << name << std::right << std::fixed
+			<< std::setw(10) << std::setprecision(2) << seconds * 1000.0 << " ms"
+			<< std::setw(12) << std::setprecision(1) << megabytes / safeSeconds << " MB/s"
+			<< std::setw(14) << std::setprecision(0) << numObjects / safeSeconds << " objects/s" << std::endl;
+	}
+
+	void Benchmark::printRate(const String& name, double seconds, UINT64 count, const String& itemName)
+	{
+		double safeSeconds = std::max(seconds, 0.000001);
+
+		std::cout << std::left << std::setw(48) << name << std::right << std::fixed
+			<< std::setw(10) << std::setprecision(2) << seconds * 1000.0 << " ms"
+			<< std::setw(14) << std::setprecision(0) << count / safeSeconds << " " << itemName << "/s" << std::endl;
+	}
+
+	void Benchmark::printLine(const String& text)
+	{
+		std::cout << text << std::endl;
+	}
+}
\ No newline at end of file
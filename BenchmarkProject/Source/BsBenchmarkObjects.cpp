@@ -0,0 +1,160 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsBenchmarkObjects.h"
+#include "BsBenchmarkObjectsRTTI.h"
+
+namespace BansheeEngine
+{
+	BenchmarkDataBlock::BenchmarkDataBlock()
+	{ }
+
+	std::shared_ptr<BenchmarkDataBlock> BenchmarkDataBlock::create(UINT32 size)
+	{
+		std::shared_ptr<BenchmarkDataBlock> dataBlock = bs_shared_ptr<BenchmarkDataBlock>();
+
+		dataBlock->mData.resize(size);
+		for (UINT32 i = 0; i < size; i++)
+			dataBlock->mData[i] = (UINT8)((i * 31) ^ (i >> 8));
+
+		return dataBlock;
+	}
+
+	RTTITypeBase* BenchmarkDataBlock::getRTTIStatic()
+	{
+		return BenchmarkDataBlockRTTI::instance();
+	}
+
+	RTTITypeBase* BenchmarkDataBlock::getRTTI() const
+	{
+		return BenchmarkDataBlock::getRTTIStatic();
+	}
+
+	BenchmarkArrays::BenchmarkArrays()
+	{ }
+
+	std::shared_ptr<BenchmarkArrays> BenchmarkArrays::create(UINT32 numValues, UINT32 numStrings)
+	{
+		std::shared_ptr<BenchmarkArrays> arrays = bs_shared_ptr<BenchmarkArrays>();
+
+		arrays->mIntegers.resize(numValues);
+		arrays->mFloats.resize(numValues);
+		for (UINT32 i = 0; i < numValues; i++)
+		{
+			arrays->mIntegers[i] = i * 2654435761U;
+			arrays->mFloats[i] = i * 0.5f;
+		}
+
+		arrays->mStrings.resize(numStrings);
+		for (UINT32 i = 0; i < numStrings; i++)
+			arrays->mStrings[i] = "String entry number " + toString(i);
+
+		return arrays;
+	}
+
+	RTTITypeBase* BenchmarkArrays::getRTTIStatic()
+	{
+		return BenchmarkArraysRTTI::instance();
+	}
+
+	RTTITypeBase* BenchmarkArrays::getRTTI() const
+	{
+		return BenchmarkArrays::getRTTIStatic();
+	}
+
+	BenchmarkNode::BenchmarkNode()
+		:mId(0), mWeight(0.0f)
+	{ }
+
+	std::shared_ptr<BenchmarkNode> BenchmarkNode::createNode(UINT32 id)
+	{
+		std::shared_ptr<BenchmarkNode> node = bs_shared_ptr<BenchmarkNode>();
+		node->mId = id;
+		node->mWeight = id * 0.25f;
+		node->mName = "Node " + toString(id);
+
+		return node;
+	}
+
+	std::shared_ptr<BenchmarkNode> BenchmarkNode::createHierarchy(UINT32 depth, UINT32 numChildren, UINT64& numObjects)
+	{
+		numObjects = 1;
+		std::shared_ptr<BenchmarkNode> root = createNode(0);
+
+		Vector<std::shared_ptr<BenchmarkNode>> currentLevel = { root };
+		for (UINT32 i = 1; i < depth; i++)
+		{
+			Vector<std::shared_ptr<BenchmarkNode>> nextLevel;
+			nextLevel.reserve(currentLevel.size() * numChildren);
+
+			for (auto& parent : currentLevel)
+			{
+				for (UINT32 j = 0; j < numChildren; j++)
+				{
+					std::shared_ptr<BenchmarkNode> child = createNode((UINT32)numObjects++);
+
+					parent->mChildren.push_back(child);
+					nextLevel.push_back(child);
+				}
+			}
+
+			currentLevel = std::move(nextLevel);
+		}
+
+		return root;
+	}
+
+	std::shared_ptr<BenchmarkNode> BenchmarkNode::createArrays(UINT32 numValues, UINT32 numStrings, UINT64& numObjects)
+	{
+		std::shared_ptr<BenchmarkNode> root = createNode(0);
+		root->mArrays.push_back(BenchmarkArrays::create(numValues, numStrings));
+
+		numObjects = 2;
+		return root;
+	}
+
+	std::shared_ptr<BenchmarkNode> BenchmarkNode::createReferenceGraph(UINT32 numNodes, UINT32 numReferences, UINT64& numObjects)
+	{
+		std::shared_ptr<BenchmarkNode> root = createNode(0);
+		root->mChildren.reserve(numNodes * 2);
+
+		for (UINT32 i = 0; i < numNodes; i++)
+			root->mChildren.push_back(createNode(i + 1));
+
+		// Referencing nodes only point to the leaf nodes, so the graph has no cycles
+		for (UINT32 i = 0; i < numNodes; i++)
+		{
+			std::shared_ptr<BenchmarkNode> node = createNode(numNodes + i + 1);
+
+			node->mReferences.reserve(numReferences);
+			for (UINT32 j = 0; j < numReferences; j++)
+				node->mReferences.push_back(root->mChildren[(i * 7919 + j * 104729) % numNodes]);
+
+			root->mChildren.push_back(node);
+		}
+
+		numObjects = 1 + (UINT64)numNodes * 2;
+		return root;
+	}
+
+	std::shared_ptr<BenchmarkNode> BenchmarkNode::createDataBlocks(UINT32 numBlocks, UINT32 blockSize, UINT64& numObjects)
+	{
+		std::shared_ptr<BenchmarkNode> root = createNode(0);
+
+		for (UINT32 i = 0; i < numBlocks; i++)
+			root->mDataBlocks.push_back(BenchmarkDataBlock::create(blockSize));
+
+		numObjects = 1 + (UINT64)numBlocks;
+		return root;
+	}
+
+	RTTITypeBase* BenchmarkNode::getRTTIStatic()
+	{
+		return BenchmarkNodeRTTI::instance();
+	}
+
+	RTTITypeBase* BenchmarkNode::getRTTI() const
+	{
+		return BenchmarkNode::getRTTIStatic();
+	}
+}
\ No newline at end of file
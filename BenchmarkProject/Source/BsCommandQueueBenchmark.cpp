@@ -0,0 +1,123 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsBenchmark.h"
+#include "BsCommandQueue.h"
+#include "BsFrameCommandBuffer.h"
+#include "BsFrameAlloc.h"
+#include "BsCoreThread.h"
+#include "BsThreadPool.h"
+
+namespace BansheeEngine
+{
+	static const UINT32 NUM_QUEUED_COMMANDS = 1000000;
+	static const UINT32 NUM_RECORDED_COMMANDS = 1000000;
+
+	/**
+	 * @brief	Returns the number of commands flushed from a regular command queue.
+	 */
+	static UINT64 countCommands(Queue<QueuedCommand>* commands)
+	{
+		return commands->size();
+	}
+
+	/**
+	 * @brief	Returns the number of commands flushed from a lock-free command queue.
+	 */
+	static UINT64 countCommands(CommandQueue<CommandQueueLockFree>::CommandNode* commands)
+	{
+		UINT64 numCommands = 0;
+		for (auto node = commands; node != nullptr; node = node->next)
+			numCommands++;
+
+		return numCommands;
+	}
+
+	/**
+	 * @brief	Measures the time it takes for "numProducers" threads to queue "numCommandsPerProducer" commands each
+	 *			on a command queue, while the calling thread keeps flushing and playing back the queued commands.
+	 */
+	template<class SyncPolicy>
+	static double measureMultiProducerQueue(UINT32 numProducers, UINT32 numCommandsPerProducer)
+	{
+		return Benchmark::measure([&]()
+		{
+			CommandQueue<SyncPolicy> commandQueue(BS_THREAD_CURRENT_ID);
+			UINT64 numTotalCommands = (UINT64)numProducers * numCommandsPerProducer;
+			UINT64 sum = 0;
+
+			Vector<HThread> producers(numProducers);
+			for (UINT32 i = 0; i < numProducers; i++)
+			{
+				producers[i] = ThreadPool::instance().run("BenchmarkProducer", [&commandQueue, &sum, numCommandsPerProducer]()
+				{
+					for (UINT32 j = 0; j < numCommandsPerProducer; j++)
+						commandQueue.queue([&sum, j]() { sum += j; });
+				});
+			}
+
+			UINT64 numPlayedBack = 0;
+			while (numPlayedBack < numTotalCommands)
+			{
+				auto commands = commandQueue.flush();
+				numPlayedBack += countCommands(commands);
+
+				commandQueue.playback(commands);
+			}
+
+			for (auto& producer : producers)
+				producer.blockUntilComplete();
+		}, Benchmark::NUM_RUNS);
+	}
+
+	/**
+	 * @brief	Runs all command queue benchmarks. Must be called on the core thread, as command queues
+	 *			may only be played back on it.
+	 */
+	static void runCoreThreadCommandQueueBenchmarks()
+	{
+		UINT32 numProducers = std::max(2U, (UINT32)BS_THREAD_HARDWARE_CONCURRENCY - 1);
+		UINT32 numCommandsPerProducer = NUM_QUEUED_COMMANDS / numProducers;
+		UINT64 numTotalCommands = (UINT64)numProducers * numCommandsPerProducer;
+
+		Benchmark::printTitle("Command queues (" + toString(numProducers) + " producer threads, " +
+			toString(numTotalCommands) + " commands)");
+
+		double syncTime = measureMultiProducerQueue<CommandQueueSync>(numProducers, numCommandsPerProducer);
+		Benchmark::printRate("CommandQueue<CommandQueueSync>", syncTime, numTotalCommands, "commands");
+
+		double lockFreeTime = measureMultiProducerQueue<CommandQueueLockFree>(numProducers, numCommandsPerProducer);
+		Benchmark::printRate("CommandQueue<CommandQueueLockFree>", lockFreeTime, numTotalCommands, "commands");
+
+		Benchmark::printTitle("Single threaded command recording (" + toString(NUM_RECORDED_COMMANDS) + " commands)");
+
+		UINT64 sum = 0;
+		double noSyncTime = Benchmark::measure([&]()
+		{
+			CommandQueue<CommandQueueNoSync> commandQueue(BS_THREAD_CURRENT_ID);
+			for (UINT32 i = 0; i < NUM_RECORDED_COMMANDS; i++)
+				commandQueue.queue([&sum, i]() { sum += i; });
+
+			commandQueue.playback(commandQueue.flush());
+		}, Benchmark::NUM_RUNS);
+
+		Benchmark::printRate("CommandQueue<CommandQueueNoSync>", noSyncTime, NUM_RECORDED_COMMANDS, "commands");
+
+		FrameAlloc frameAlloc;
+		double frameBufferTime = Benchmark::measure([&]()
+		{
+			FrameCommandBuffer* commandBuffer = FrameCommandBuffer::create(&frameAlloc);
+			for (UINT32 i = 0; i < NUM_RECORDED_COMMANDS; i++)
+				commandBuffer->queue([&sum, i]() { sum += i; });
+
+			FrameCommandBuffer::executeAndDestroy(commandBuffer);
+		}, Benchmark::NUM_RUNS, nullptr, [&]() { frameAlloc.clear(); });
+
+		Benchmark::printRate("FrameCommandBuffer", frameBufferTime, NUM_RECORDED_COMMANDS, "commands");
+	}
+
+	void runCommandQueueBenchmarks()
+	{
+		gCoreThread().queueCommand(&runCoreThreadCommandQueueBenchmarks, true);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,276 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsBenchmark.h"
+#include "BsBenchmarkObjects.h"
+#include "BsMemorySerializer.h"
+#include "BsFileSerializer.h"
+#include "BsFileSystem.h"
+#include "BsPath.h"
+#include "BsSceneObject.h"
+#include "BsGameObjectManager.h"
+#include "BsMeshData.h"
+#include "BsVertexDataDesc.h"
+#include "BsPixelData.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * @brief	Object serialized by the benchmark, along with information needed for reporting and clean up.
+	 */
+	struct SerializationCase
+	{
+		String name;
+		std::shared_ptr<IReflectable> object;
+		UINT64 numObjects;
+		bool isSceneObject;
+	};
+
+	static const UINT32 NUM_SCENE_OBJECTS = 50000;
+	static const UINT32 NUM_SCENE_OBJECT_CHILDREN = 8;
+	static const UINT32 NUM_MESH_VERTICES = 1024 * 1024;
+	static const UINT32 TEXTURE_SIZE = 2048;
+
+	/**
+	 * @brief	Creates a hierarchy of "numObjects" scene objects in which each object has up to "numChildren" children.
+	 */
+	static HSceneObject createSceneObjectHierarchy(UINT32 numObjects, UINT32 numChildren)
+	{
+		Vector<HSceneObject> sceneObjects;
+		sceneObjects.reserve(numObjects);
+
+		for (UINT32 i = 0; i < numObjects; i++)
+		{
+			HSceneObject sceneObject = SceneObject::create("Object " + toString(i));
+			if (i > 0)
+				sceneObject->setParent(sceneObjects[(i - 1) / numChildren]);
+
+			sceneObjects.push_back(sceneObject);
+		}
+
+		return sceneObjects[0];
+	}
+
+	/**
+	 * @brief	Creates mesh data with positions, normals and texture coordinates, and three indices per vertex.
+	 */
+	static MeshDataPtr createMeshData(UINT32 numVertices)
+	{
+		VertexDataDescPtr vertexDesc = bs_shared_ptr<VertexDataDesc>();
+		vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
+		vertexDesc->addVertElem(VET_FLOAT3, VES_NORMAL);
+		vertexDesc->addVertElem(VET_FLOAT2, VES_TEXCOORD);
+
+		UINT32 numIndices = numVertices * 3;
+		MeshDataPtr meshData = bs_shared_ptr<MeshData>(numVertices, numIndices, vertexDesc);
+
+		Vector<float> positions(numVertices * 3);
+		Vector<float> normals(numVertices * 3);
+		Vector<float> uvs(numVertices * 2);
+		for (UINT32 i = 0; i < numVertices; i++)
+		{
+			for (UINT32 j = 0; j < 3; j++)
+			{
+				positions[i * 3 + j] = ((i + j) % 1024) * 0.125f;
+				normals[i * 3 + j] = j == 1 ? 1.0f : 0.0f;
+			}
+
+			uvs[i * 2 + 0] = (i % 1024) / 1024.0f;
+			uvs[i * 2 + 1] = (i / 1024) / 1024.0f;
+		}
+
+		meshData->setVertexData(VES_POSITION, (UINT8*)positions.data(), (UINT32)(positions.size() * sizeof(float)));
+		meshData->setVertexData(VES_NORMAL, (UINT8*)normals.data(), (UINT32)(normals.size() * sizeof(float)));
+		meshData->setVertexData(VES_TEXCOORD, (UINT8*)uvs.data(), (UINT32)(uvs.size() * sizeof(float)));
+
+		UINT32* indices = meshData->getIndices32();
+		for (UINT32 i = 0; i < numIndices; i++)
+			indices[i] = (i * 7) % numVertices;
+
+		return meshData;
+	}
+
+	/**
+	 * @brief	Creates a square RGBA texture filled with a gradient.
+	 */
+	static PixelDataPtr createPixelData(UINT32 size)
+	{
+		PixelDataPtr pixelData = bs_shared_ptr<PixelData>(size, size, 1, PF_R8G8B8A8);
+		pixelData->allocateInternalBuffer();
+
+		UINT8* pixels = pixelData->getData();
+		UINT32 numBytes = pixelData->getConsecutiveSize();
+		for (UINT32 i = 0; i < numBytes; i++)
+			pixels[i] = (UINT8)((i / 4) % size + i % 4);
+
+		return pixelData;
+	}
+
+	/**
+	 * @brief	Releases an object decoded by the benchmark.
+	 */
+	static void destroyDecoded(const SerializationCase& serializationCase, std::shared_ptr<IReflectable>& decoded)
+	{
+		if (decoded == nullptr)
+			return;
+
+		if (serializationCase.isSceneObject)
+			std::static_pointer_cast<SceneObject>(decoded)->destroy();
+
+		decoded = nullptr;
+	}
+
+	/**
+	 * @brief	Decodes an object using the provided method, while making sure game object handles
+	 *			get resolved for scene objects.
+	 */
+	static std::shared_ptr<IReflectable> decodeCase(const SerializationCase& serializationCase,
+		const std::function<std::shared_ptr<IReflectable>()>& decode)
+	{
+		if (!serializationCase.isSceneObject)
+			return decode();
+
+		GameObjectManager::instance().startDeserialization();
+		std::shared_ptr<IReflectable> decoded = decode();
+		GameObjectManager::instance().endDeserialization();
+
+		return decoded;
+	}
+
+	/**
+	 * @brief	Measures MemorySerializer encoding (serial and parallel) and decoding of the provided object.
+	 */
+	static void runMemorySerializerBenchmarks(const SerializationCase& serializationCase)
+	{
+		MemorySerializer serializer;
+		IReflectable* object = serializationCase.object.get();
+
+		UINT32 numBytes = 0;
+		double encodeTime = Benchmark::measure([&]() { serializer.encodeToBuffer(object, numBytes); }, Benchmark::NUM_RUNS);
+		Benchmark::printThroughput("MemorySerializer encode", encodeTime, numBytes, serializationCase.numObjects);
+
+		double parallelEncodeTime = Benchmark::measure([&]() { serializer.encodeToBuffer(object, numBytes, true); }, Benchmark::NUM_RUNS);
+		Benchmark::printThroughput("MemorySerializer encode (parallel)", parallelEncodeTime, numBytes, serializationCase.numObjects);
+
+		UINT8* buffer = serializer.encodeToBuffer(object, numBytes);
+		Vector<UINT8> encodedData(buffer, buffer + numBytes);
+
+		std::shared_ptr<IReflectable> decoded;
+		double decodeTime = Benchmark::measure([&]()
+		{
+			decoded = decodeCase(serializationCase, [&]() { return serializer.decode(encodedData.data(), numBytes); });
+		}, Benchmark::NUM_RUNS, nullptr, [&]() { destroyDecoded(serializationCase, decoded); });
+
+		Benchmark::printThroughput("MemorySerializer decode", decodeTime, numBytes, serializationCase.numObjects);
+	}
+
+	/**
+	 * @brief	Measures FileSerializer encoding and decoding of the provided object, either with or without compression.
+	 */
+	static void runFileSerializerBenchmarks(const SerializationCase& serializationCase, bool compress)
+	{
+		Path filePath = FileSystem::getWorkingDirectoryPath();
+		filePath.append("SerializationBenchmark.asset");
+
+		IReflectable* object = serializationCase.object.get();
+		String suffix = compress ? " (compressed)" : "";
+
+		double encodeTime = Benchmark::measure([&]()
+		{
+			FileSerializer serializer;
+			serializer.encode(object, filePath, compress);
+		}, Benchmark::NUM_RUNS);
+
+		double parallelEncodeTime = Benchmark::measure([&]()
+		{
+			FileSerializer serializer;
+			serializer.encode(object, filePath, compress, nullptr, true);
+		}, Benchmark::NUM_RUNS);
+
+		UINT64 fileSize = FileSystem::getFileSize(filePath);
+		Benchmark::printThroughput("FileSerializer encode" + suffix, encodeTime, fileSize, serializationCase.numObjects);
+		Benchmark::printThroughput("FileSerializer encode (parallel)" + suffix, parallelEncodeTime, fileSize, serializationCase.numObjects);
+
+		std::shared_ptr<IReflectable> decoded;
+		auto cleanUp = [&]() { destroyDecoded(serializationCase, decoded); };
+
+		double decodeTime = Benchmark::measure([&]()
+		{
+			FileSerializer serializer;
+			decoded = decodeCase(serializationCase, [&]() { return serializer.decode(filePath); });
+		}, Benchmark::NUM_RUNS, nullptr, cleanUp);
+
+		Benchmark::printThroughput("FileSerializer decode" + suffix, decodeTime, fileSize, serializationCase.numObjects);
+
+		double mappedDecodeTime = Benchmark::measure([&]()
+		{
+			FileSerializer serializer;
+			decoded = decodeCase(serializationCase, [&]() { return serializer.decodeMapped(filePath); });
+		}, Benchmark::NUM_RUNS, nullptr, cleanUp);
+
+		Benchmark::printThroughput("FileSerializer decodeMapped" + suffix, mappedDecodeTime, fileSize, serializationCase.numObjects);
+
+		if (compress)
+		{
+			MemorySerializer memorySerializer;
+			UINT32 uncompressedSize = 0;
+			memorySerializer.encodeToBuffer(object, uncompressedSize);
+
+			Benchmark::printLine("File size: " + toString(fileSize) + " bytes compressed, " + toString(uncompressedSize) +
+				" bytes uncompressed (" + toString(fileSize * 100.0 / std::max(uncompressedSize, 1U), 4) + "%)");
+		}
+
+		FileSystem::remove(filePath);
+	}
+
+	void runSerializationBenchmarks()
+	{
+		Vector<SerializationCase> cases;
+
+		UINT64 numObjects = 0;
+		std::shared_ptr<IReflectable> object = BenchmarkNode::createHierarchy(8, 4, numObjects);
+		cases.push_back({ "Node hierarchy (depth 8, 4 children)", object, numObjects, false });
+
+		object = BenchmarkNode::createHierarchy(500, 1, numObjects);
+		cases.push_back({ "Node chain (depth 500)", object, numObjects, false });
+
+		object = BenchmarkNode::createArrays(1024 * 1024, 16 * 1024, numObjects);
+		cases.push_back({ "Plain and string arrays", object, numObjects, false });
+
+		object = BenchmarkNode::createReferenceGraph(10000, 16, numObjects);
+		cases.push_back({ "Shared references (10000 nodes, 16 each)", object, numObjects, false });
+
+		object = BenchmarkNode::createDataBlocks(16, 4 * 1024 * 1024, numObjects);
+		cases.push_back({ "Data blocks (16 x 4 MB)", object, numObjects, false });
+
+		HSceneObject sceneObjectRoot = createSceneObjectHierarchy(NUM_SCENE_OBJECTS, NUM_SCENE_OBJECT_CHILDREN);
+		cases.push_back({ "SceneObject hierarchy (" + toString(NUM_SCENE_OBJECTS) + " objects)",
+			sceneObjectRoot.getInternalPtr(), NUM_SCENE_OBJECTS, true });
+
+		cases.push_back({ "MeshData (" + toString(NUM_MESH_VERTICES) + " vertices)",
+			createMeshData(NUM_MESH_VERTICES), 2, false });
+
+		cases.push_back({ "PixelData (" + toString(TEXTURE_SIZE) + "x" + toString(TEXTURE_SIZE) + " RGBA)",
+			createPixelData(TEXTURE_SIZE), 1, false });
+
+		for (auto& serializationCase : cases)
+		{
+			Benchmark::printTitle("Serialization: " + serializationCase.name);
+
+			runMemorySerializerBenchmarks(serializationCase);
+			runFileSerializerBenchmarks(serializationCase, false);
+			runFileSerializerBenchmarks(serializationCase, true);
+		}
+
+		Benchmark::printTitle("SceneObject::clone (" + toString(NUM_SCENE_OBJECTS) + " objects)");
+
+		MemorySerializer cloneSerializer;
+		HSceneObject clone;
+		double cloneTime = Benchmark::measure([&]() { clone = sceneObjectRoot->clone(cloneSerializer); }, Benchmark::NUM_RUNS,
+			nullptr, [&]() { clone->destroy(); });
+
+		Benchmark::printRate("Clone with a reused serializer", cloneTime, NUM_SCENE_OBJECTS, "objects");
+
+		sceneObjectRoot->destroy();
+	}
+}
\ No newline at end of file
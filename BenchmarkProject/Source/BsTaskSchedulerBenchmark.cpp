@@ -0,0 +1,105 @@
+//__________________________ Banshee Project - A modern game development toolkit _________________________________//
+//_____________________________________ www.banshee-project.com __________________________________________________//
+//________________________ Copyright (c) 2014 Marko Pintera. All rights reserved. ________________________________//
+#include "BsBenchmark.h"
+#include "BsTaskScheduler.h"
+#include "BsThreadPool.h"
+#include "BsParallel.h"
+
+namespace BansheeEngine
+{
+	static const UINT32 NUM_TASKS = 100000;
+	static const UINT32 NUM_PARALLEL_FOR_ITEMS = 4 * 1024 * 1024;
+
+	/**
+	 * @brief	Small amount of work executed by each task.
+	 */
+	static UINT64 doTaskWork(UINT32 seed)
+	{
+		UINT64 value = seed;
+		for (UINT32 i = 0; i < 64; i++)
+			value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+
+		return value;
+	}
+
+	void runTaskSchedulerBenchmarks()
+	{
+		Benchmark::printTitle("TaskScheduler (" + toString(NUM_TASKS) + " small tasks, " +
+			toString(TaskScheduler::instance().getNumWorkers()) + " workers)");
+
+		Vector<UINT64> results(NUM_TASKS);
+
+		// Queue all tasks and wait on a single task depending on all of them
+		double joinTime = Benchmark::measure([&]()
+		{
+			Vector<TaskPtr> tasks(NUM_TASKS);
+			for (UINT32 i = 0; i < NUM_TASKS; i++)
+			{
+				tasks[i] = Task::create("BenchmarkTask", [&results, i]() { results[i] = doTaskWork(i); });
+				TaskScheduler::instance().addTask(tasks[i]);
+			}
+
+			TaskPtr joinTask = Task::create("BenchmarkJoin", nullptr, TaskPriority::Normal, tasks);
+			TaskScheduler::instance().addTask(joinTask);
+			joinTask->wait();
+		}, Benchmark::NUM_RUNS);
+
+		Benchmark::printRate("Queue tasks, wait on a join task", joinTime, NUM_TASKS, "tasks");
+
+		// Queue all tasks and wait on each one individually
+		double waitTime = Benchmark::measure([&]()
+		{
+			Vector<TaskPtr> tasks(NUM_TASKS);
+			for (UINT32 i = 0; i < NUM_TASKS; i++)
+			{
+				tasks[i] = Task::create("BenchmarkTask", [&results, i]() { results[i] = doTaskWork(i); });
+				TaskScheduler::instance().addTask(tasks[i]);
+			}
+
+			for (auto& task : tasks)
+				task->wait();
+		}, Benchmark::NUM_RUNS);
+
+		Benchmark::printRate("Queue tasks, wait on each task", waitTime, NUM_TASKS, "tasks");
+
+		// Baseline: dispatch each piece of work on its own pooled thread, in batches of one per hardware thread
+		UINT32 batchSize = std::max(1U, (UINT32)BS_THREAD_HARDWARE_CONCURRENCY);
+		double threadPoolTime = Benchmark::measure([&]()
+		{
+			Vector<HThread> threads(batchSize);
+			for (UINT32 i = 0; i < NUM_TASKS; i += batchSize)
+			{
+				UINT32 numThreads = std::min(batchSize, NUM_TASKS - i);
+				for (UINT32 j = 0; j < numThreads; j++)
+				{
+					UINT32 idx = i + j;
+					threads[j] = ThreadPool::instance().run("BenchmarkThread", [&results, idx]() { results[idx] = doTaskWork(idx); });
+				}
+
+				for (UINT32 j = 0; j < numThreads; j++)
+					threads[j].blockUntilComplete();
+			}
+		}, Benchmark::NUM_RUNS);
+
+		Benchmark::printRate("ThreadPool::run per task (baseline)", threadPoolTime, NUM_TASKS, "tasks");
+
+		Benchmark::printTitle("parallelFor (" + toString(NUM_PARALLEL_FOR_ITEMS) + " items)");
+
+		Vector<UINT64> items(NUM_PARALLEL_FOR_ITEMS);
+		double serialTime = Benchmark::measure([&]()
+		{
+			for (UINT32 i = 0; i < NUM_PARALLEL_FOR_ITEMS; i++)
+				items[i] = doTaskWork(i);
+		}, Benchmark::NUM_RUNS);
+
+		Benchmark::printRate("Serial loop", serialTime, NUM_PARALLEL_FOR_ITEMS, "items");
+
+		double parallelTime = Benchmark::measure([&]()
+		{
+			parallelFor(0, NUM_PARALLEL_FOR_ITEMS, [&items](UINT32 i) { items[i] = doTaskWork(i); });
+		}, Benchmark::NUM_RUNS);
+
+		Benchmark::printRate("parallelFor", parallelTime, NUM_PARALLEL_FOR_ITEMS, "items");
+	}
+}
\ No newline at end of file